@@ -0,0 +1,82 @@
+#!/bin/bash
+# Compares the backends end to end on generated programs: building an executable and running it, running the
+# compiled code in-process (--run), and interpreting bytecode (--interpret). The last two columns are the time spent
+# running the program alone, natively and on the bytecode VM. Each time is the best of several runs.
+#
+#   bench/backends.sh [statements...]    (default: 100 1000 5000 20000 100000)
+#
+# Uses bin/mathc; build it first with `make release`.
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+MATHC="$ROOT/bin/mathc"
+WORK="$(mktemp -d)"
+REPEAT=5
+trap 'rm -rf "$WORK"' EXIT
+
+# Programs have no inputs, so at the default -O1 every generated program would fold to printing constants and the
+# backends would never run it. Everything is compiled at -O0 instead.
+OPT=-O0
+
+# A program of `n` statements over 16 variables, mixing all operators, printing every 16th value and feeding each
+# statement from the values of earlier ones
+generate() {
+    awk -v n="$1" 'BEGIN {
+        split("+ - * / // %", ops, " ");
+        srand(1);
+        for (i = 0; i < 16; ++i) printf "v%d = %d.%d;\n", i, i + 1, i;
+        for (i = 0; i < n; ++i) {
+            op = ops[int(rand() * 6) + 1];
+            printf "v%d = v%d %s (v%d + %d.5);\n", i % 16, int(rand() * 16), op, int(rand() * 16), int(rand() * 9) + 1;
+            if (i % 16 == 15) printf "print(v%d);\n", i % 16;
+        }
+    }'
+}
+
+# Best wall time of REPEAT runs of the command, in milliseconds
+best_ms() {
+    local best=""
+    for _ in $(seq "$REPEAT"); do
+        local start end elapsed
+        start=$(date +%s%N)
+        "$@" >/dev/null 2>&1
+        end=$(date +%s%N)
+        elapsed=$(((end - start) / 1000))
+        if [ -z "$best" ] || [ "$elapsed" -lt "$best" ]; then
+            best=$elapsed
+        fi
+    done
+    printf "%d.%03d" $((best / 1000)) $((best % 1000))
+}
+
+# Best time of REPEAT runs spent running the program, without compiling it, as reported by --time, in milliseconds
+best_exec_ms() {
+    local best=""
+    for _ in $(seq "$REPEAT"); do
+        local elapsed
+        elapsed=$("$@" --time 2>&1 >/dev/null | sed -n 's/.*ran in \([0-9.]*\)ms.*/\1/p')
+        if [ -z "$best" ] || awk -v a="$elapsed" -v b="$best" 'BEGIN { exit !(a < b) }'; then
+            best=$elapsed
+        fi
+    done
+    printf "%.3f" "$best"
+}
+
+build_and_run() {
+    (cd "$WORK" && "$MATHC" "bench.math" "$OPT" && ./build/bench)
+}
+
+printf "%12s %16s %12s %14s %16s %16s\n" "statements" "build + exec ms" "--run ms" "--interpret ms" "native exec ms" \
+    "bytecode exec ms"
+sizes=("$@")
+if [ ${#sizes[@]} -eq 0 ]; then
+    sizes=(100 1000 5000 20000 100000)
+fi
+for count in "${sizes[@]}"; do
+    generate "$count" > "$WORK/bench.math"
+    printf "%12d %16s %12s %14s %16s %16s\n" "$count" "$(best_ms build_and_run)" \
+        "$(best_ms "$MATHC" "$WORK/bench.math" "$OPT" --run)" \
+        "$(best_ms "$MATHC" "$WORK/bench.math" "$OPT" --interpret)" \
+        "$(best_exec_ms "$MATHC" "$WORK/bench.math" "$OPT" --run)" \
+        "$(best_exec_ms "$MATHC" "$WORK/bench.math" "$OPT" --interpret)"
+done
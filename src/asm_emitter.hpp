@@ -1,242 +1,892 @@
 #pragma once
 
 #include "mathc_common.hpp"
+#include "chunked_buffer.hpp"
+#include "symbol_table.hpp"
+#include "asm_instruction.hpp"
+#include "peephole.hpp"
+#include "target.hpp"
+#include "var_layout.hpp"
+#include "x86_encoder.hpp"
+#include "elf_object.hpp"
+#include "elf_reader.hpp"
+#include "elf_executable.hpp"
+#include "jit.hpp"
 
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <algorithm>
+#include <bit>
+#include <unordered_map>
+#include <type_traits>
+#include <unordered_set>
 
 namespace mathc {
+    /// @brief A compiled program: NASM source with `--emit=asm`, one buffer per section, the bytes of an object file
+    /// with `--emit=obj`, otherwise the bytes of a complete executable
+    struct program_output {
+        vector<chunked_buffer> assembly;
+        vector<u8> object;
+        vector<u8> executable;
+        jit_code jit;  // with `--run`
+    };
+
     class asm_emitter {
     public:
-        asm_emitter() : var_count_(0), has_print_(false) {}
+        /// Number of xmm registers available for expression temporaries. Baseline x86-64 keeps the last two for
+        /// `emit_floor`.
+        static constexpr u8 usable_registers(target_arch arch) {
+            return target_info::has_round(arch) ? 16 : floor_temp;
+        }
+
+        explicit asm_emitter(target_arch arch = target_arch::ARCH_X86_64_V2) : arch_(arch), has_print_(false) {}
 
         asm_emitter& emit_nop() {
-            code_oss_ << "    nop\n";
-            return *this;
+            return emit(asm_opcode::OP_NOP);
         }
 
-        asm_emitter& emit_push(f64 value) {
-            // Load immediate value into xmm0 via memory
-            code_oss_ << "    mov rax, " << double_to_hex(value) << "\n";
-            code_oss_ << "    movq xmm0, rax\n";
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
-        }
+        // Load a value into a register
+        asm_emitter& emit_load(u8 dst, const asm_operand& src) {
+            if (src.kind == operand_kind::OPERAND_XMM) {
+                if (src.index != dst) {
+                    emit(asm_opcode::OP_MOVAPD, asm_operand::xmm(dst), src);
+                }
+                return *this;
+            }
 
-        asm_emitter& emit_pop() {
-            // Pop top of stack into xmm1 (second operand)
-            code_oss_ << "    movsd xmm1, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            return *this;
+            if (src.kind == operand_kind::OPERAND_LITERAL && src.value == 0) {
+                // +0.0 without a memory load
+                return emit(asm_opcode::OP_XORPD, asm_operand::xmm(dst), asm_operand::xmm(dst));
+            }
+
+            return emit(asm_opcode::OP_MOVSD, asm_operand::xmm(dst), src);
         }
 
-        asm_emitter& emit_add() {
-            emit_pop();
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    addsd xmm0, xmm1\n";
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
+        asm_emitter& emit_add(u8 dst, const asm_operand& src) {
+            return emit(asm_opcode::OP_ADDSD, asm_operand::xmm(dst), src);
         }
 
-        asm_emitter& emit_sub() {
-            emit_pop();
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    subsd xmm0, xmm1\n";
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
+        asm_emitter& emit_sub(u8 dst, const asm_operand& src) {
+            return emit(asm_opcode::OP_SUBSD, asm_operand::xmm(dst), src);
         }
 
-        asm_emitter& emit_mul() {
-            emit_pop();
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    mulsd xmm0, xmm1\n";
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
+        asm_emitter& emit_mul(u8 dst, const asm_operand& src) {
+            return emit(asm_opcode::OP_MULSD, asm_operand::xmm(dst), src);
         }
 
-        asm_emitter& emit_div() {
-            emit_pop();
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    divsd xmm0, xmm1\n";
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
+        asm_emitter& emit_div(u8 dst, const asm_operand& src) {
+            return emit(asm_opcode::OP_DIVSD, asm_operand::xmm(dst), src);
         }
 
-        asm_emitter& emit_mod() {
+        asm_emitter& emit_mod(u8 dst, const asm_operand& src, u8 scratch) {
             // Floating-point modulo: a % b = a - floor(a/b) * b
-            emit_pop();
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    movsd xmm2, xmm0\n";       // Save a
-            code_oss_ << "    movsd xmm3, xmm1\n";       // Save b
-            code_oss_ << "    divsd xmm0, xmm1\n";       // a / b
-            code_oss_ << "    roundsd xmm0, xmm0, 1\n";  // floor(a/b)
-            code_oss_ << "    mulsd xmm0, xmm3\n";       // floor(a/b) * b
-            code_oss_ << "    subsd xmm2, xmm0\n";       // a - floor(a/b) * b
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm2\n";
-            return *this;
+            const auto a = asm_operand::xmm(dst);
+            const auto t = asm_operand::xmm(scratch);
+            emit(asm_opcode::OP_MOVAPD, t, a);                      // Copy a
+            emit(asm_opcode::OP_DIVSD, t, src);                     // a / b
+            emit_floor(scratch);                                    // floor(a/b)
+            emit(asm_opcode::OP_MULSD, t, src);                     // floor(a/b) * b
+            return emit(asm_opcode::OP_SUBSD, a, t);                // a - floor(a/b) * b
         }
 
-        asm_emitter& emit_floor_div() {
+        asm_emitter& emit_floor_div(u8 dst, const asm_operand& src) {
             // Floor division: floor(a / b)
-            emit_pop();
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    divsd xmm0, xmm1\n";
-            code_oss_ << "    roundsd xmm0, xmm0, 1\n";  // Round down (floor)
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
+            const auto a = asm_operand::xmm(dst);
+            emit(asm_opcode::OP_DIVSD, a, src);
+            return emit_floor(dst);  // Round down (floor)
         }
 
-        // Declare a variable in the .bss section (returns the label name)
-        string declare_var(const string& name) {
-            auto it = var_labels_.find(name);
-            if (it != var_labels_.end()) {
-                return it->second;  // Already declared
+        // Round down to an integer. Without SSE4.1 the value is truncated through a 64-bit integer in rax and
+        // corrected by -1 where that rounded up; values of 2^52 or more are already integers and are kept, as are
+        // infinities and NaN, and the sign is copied back so -0.0 stays -0.0.
+        asm_emitter& emit_floor(u8 dst) {
+            const auto a = asm_operand::xmm(dst);
+            if (target_info::has_round(arch_)) {
+                return emit(asm_opcode::OP_ROUNDSD, a, a, asm_operand::imm(1));
             }
 
-            string label      = "var_" + std::to_string(var_count_++);
-            var_labels_[name] = label;
-            bss_oss_ << "    " << label << ": resq 1\n";
-            return label;
+            const auto t     = asm_operand::xmm(floor_temp);
+            const auto u     = asm_operand::xmm(floor_mask);
+            const auto rax   = asm_operand::reg(gpr::GPR_RAX);
+            const auto exact = asm_operand::constant(0x1p104);  // Squares of 2^52 and up
+            const auto sign  = asm_operand::constant(-0.0);
+            emit(asm_opcode::OP_CVTTSD2SI, rax, a);
+            emit(asm_opcode::OP_CVTSI2SD, t, rax);   // trunc(a)
+            emit(asm_opcode::OP_MOVAPD, u, a);
+            emit(asm_opcode::OP_CMPLTSD, u, t);      // a < trunc(a): all ones, -1 as an integer
+            emit(asm_opcode::OP_MOVQ, rax, u);
+            emit(asm_opcode::OP_CVTSI2SD, u, rax);
+            emit(asm_opcode::OP_ADDSD, t, u);        // floor(a)
+            emit(asm_opcode::OP_MOVAPD, u, a);
+            emit(asm_opcode::OP_MULSD, u, u);
+            emit(asm_opcode::OP_CMPLTSD, u, exact);  // |a| < 2^52
+            emit(asm_opcode::OP_ANDPD, t, u);
+            emit(asm_opcode::OP_ANDNPD, u, a);
+            emit(asm_opcode::OP_ORPD, t, u);         // |a| < 2^52 ? floor(a) : a
+            emit(asm_opcode::OP_MOVSD, u, sign);
+            emit(asm_opcode::OP_ANDPD, u, a);
+            emit(asm_opcode::OP_ORPD, t, u);         // With the sign of a
+            return emit(asm_opcode::OP_MOVAPD, a, t);
         }
 
-        // Store top of stack into a variable
-        asm_emitter& emit_store_var(const string& name) {
-            string label = declare_var(name);
-            // Pop value from stack and store to memory
-            code_oss_ << "    movsd xmm0, [rsp]\n";
-            code_oss_ << "    add rsp, 8\n";
-            code_oss_ << "    movsd [" << label << "], xmm0\n";
-            return *this;
+        // a % b for b = ±2^k: `emit_mod` with the division replaced by an exact multiplication by 1/b, and without
+        // the multiplications when b is 1
+        asm_emitter& emit_mod_by_power_of_two(u8 dst, f64 divisor, u8 scratch) {
+            const auto a = asm_operand::xmm(dst);
+            const auto t = asm_operand::xmm(scratch);
+            emit(asm_opcode::OP_MOVAPD, t, a);
+            if (divisor != 1.0) {
+                emit(asm_opcode::OP_MULSD, t, asm_operand::constant(1.0 / divisor));
+            }
+            emit_floor(scratch);
+            if (divisor != 1.0) {
+                emit(asm_opcode::OP_MULSD, t, asm_operand::constant(divisor));
+            }
+            return emit(asm_opcode::OP_SUBSD, a, t);
+        }
+
+        // Load two scalars into the low and high lanes of a register
+        asm_emitter& emit_load_pair(u8 dst, const asm_operand& low, const asm_operand& high) {
+            const auto reg = asm_operand::xmm(dst);
+            emit_load(dst, low);
+            if (high == low) {
+                return emit(asm_opcode::OP_UNPCKLPD, reg, reg);
+            }
+            if (low.kind == operand_kind::OPERAND_VAR && high.kind == operand_kind::OPERAND_VAR) {
+                hint_adjacent(low.index, high.index);
+            }
+            return emit(asm_opcode::OP_MOVHPD, reg, high);
+        }
+
+        // Store the low and high lanes of a register into two variables
+        asm_emitter& emit_store_pair(symbol_id low, symbol_id high, u8 src) {
+            emit_store_var(low, src);
+            declare_var(high);
+            hint_adjacent(low, high);
+            return emit(asm_opcode::OP_MOVHPD, asm_operand::var(high), asm_operand::xmm(src));
         }
 
-        // Load a variable onto the stack
-        asm_emitter& emit_load_var(const string& name) {
-            auto it = var_labels_.find(name);
-            if (it == var_labels_.end()) {
-                // Variable not found - this is an error case
-                // For now, push 0.0
-                return emit_push(0.0);
+        // Load four scalars into the lanes of a ymm register, lowest first. The upper pair is loaded into `temp`
+        // first, which holds nothing needed afterwards.
+        asm_emitter& emit_load_quad(u8 dst, span<const asm_operand, 4> lanes, u8 temp) {
+            const auto reg = asm_operand::ymm(dst);
+            upper_dirty_   = true;
+            if (lanes[1] == lanes[0] && lanes[2] == lanes[0] && lanes[3] == lanes[0]) {
+                if (lanes[0].kind == operand_kind::OPERAND_LITERAL && lanes[0].value == 0) {
+                    return emit(asm_opcode::OP_XORPD, reg, reg);
+                }
+                return emit(asm_opcode::OP_VBROADCASTSD, reg, lanes[0]);
             }
 
-            code_oss_ << "    movsd xmm0, [" << it->second << "]\n";
-            code_oss_ << "    sub rsp, 8\n";
-            code_oss_ << "    movsd [rsp], xmm0\n";
-            return *this;
+            emit_load_pair(dst, lanes[0], lanes[1]);
+            if (lanes[2] == lanes[0] && lanes[3] == lanes[1]) {
+                return emit(asm_opcode::OP_VINSERTF128, reg, asm_operand::xmm(dst), asm_operand::imm(1));
+            }
+            if (lanes[1].kind == operand_kind::OPERAND_VAR && lanes[2].kind == operand_kind::OPERAND_VAR) {
+                hint_adjacent(lanes[1].index, lanes[2].index);
+            }
+            emit_load_pair(temp, lanes[2], lanes[3]);
+            return emit(asm_opcode::OP_VINSERTF128, reg, asm_operand::xmm(temp), asm_operand::imm(1));
+        }
+
+        // Store the four lanes of a ymm register into variables, lowest first. The upper pair goes through `temp`,
+        // which holds nothing needed afterwards.
+        asm_emitter& emit_store_quad(span<const symbol_id, 4> targets, u8 src, u8 temp) {
+            emit_store_pair(targets[0], targets[1], src);
+            emit(asm_opcode::OP_VEXTRACTF128, asm_operand::xmm(temp), asm_operand::ymm(src), asm_operand::imm(1));
+            hint_adjacent(targets[1], targets[2]);
+            return emit_store_pair(targets[2], targets[3], temp);
+        }
+
+        // Packed arithmetic on the two lanes of xmm registers, or with `lanes` 4 on the four lanes of ymm registers
+        asm_emitter& emit_packed_add(u8 dst, u8 src, u8 lanes = 2) {
+            return emit(asm_opcode::OP_ADDPD, packed(dst, lanes), packed(src, lanes));
+        }
+
+        asm_emitter& emit_packed_sub(u8 dst, u8 src, u8 lanes = 2) {
+            return emit(asm_opcode::OP_SUBPD, packed(dst, lanes), packed(src, lanes));
+        }
+
+        asm_emitter& emit_packed_mul(u8 dst, u8 src, u8 lanes = 2) {
+            return emit(asm_opcode::OP_MULPD, packed(dst, lanes), packed(src, lanes));
+        }
+
+        asm_emitter& emit_packed_div(u8 dst, u8 src, u8 lanes = 2) {
+            return emit(asm_opcode::OP_DIVPD, packed(dst, lanes), packed(src, lanes));
+        }
+
+        asm_emitter& emit_packed_mod(u8 dst, u8 src, u8 scratch, u8 lanes = 2) {
+            // Every lane of a - floor(a/b) * b, step for step like `emit_mod`
+            const auto a = packed(dst, lanes);
+            const auto b = packed(src, lanes);
+            const auto t = packed(scratch, lanes);
+            emit(asm_opcode::OP_MOVAPD, t, a);
+            emit(asm_opcode::OP_DIVPD, t, b);
+            emit(asm_opcode::OP_ROUNDPD, t, t, asm_operand::imm(1));
+            emit(asm_opcode::OP_MULPD, t, b);
+            return emit(asm_opcode::OP_SUBPD, a, t);
+        }
+
+        asm_emitter& emit_packed_floor_div(u8 dst, u8 src, u8 lanes = 2) {
+            const auto a = packed(dst, lanes);
+            emit(asm_opcode::OP_DIVPD, a, packed(src, lanes));
+            return emit(asm_opcode::OP_ROUNDPD, a, a, asm_operand::imm(1));
+        }
+
+        // Ask for `high` to be laid out right after `low`, so a pair access to them can be a single 16-byte one (and
+        // four such variables a single 32-byte one)
+        void hint_adjacent(symbol_id low, symbol_id high) {
+            if (low != high) {
+                adjacent_.emplace_back(low, high);
+            }
+        }
+
+        // Save a register in stack slot `slot` of the frame while it is needed for something else
+        asm_emitter& emit_spill(u8 reg, u32 slot) {
+            reserve_stack_slots(slot + 1);
+            return emit(asm_opcode::OP_MOVSD, asm_operand::stack(slot * 8), asm_operand::xmm(reg));
+        }
+
+        // Restore a spilled value into a register
+        asm_emitter& emit_reload(u8 reg, u32 slot) {
+            return emit(asm_opcode::OP_MOVSD, asm_operand::xmm(reg), asm_operand::stack(slot * 8));
+        }
+
+        // Make sure the frame has at least `count` 8-byte slots for spilled temporaries
+        void reserve_stack_slots(u32 count) {
+            stack_slots_ = std::max(stack_slots_, count);
+        }
+
+        [[nodiscard]] u32 get_stack_slots() const {
+            return stack_slots_;
+        }
+
+        // Declare a variable. Code refers to it by symbol id, so it does not depend on the order in which variables
+        // were declared; its slot in the variable block is only chosen when the program is rendered.
+        void declare_var(symbol_id symbol) {
+            if (has_var(symbol)) {
+                return;  // Already declared
+            }
+
+            if (symbol >= declared_.size()) {
+                declared_.resize(symbol + 1, false);
+            }
+            declared_[symbol] = true;
+            var_order_.push_back(symbol);
+        }
+
+        // Store a register into a variable
+        asm_emitter& emit_store_var(symbol_id symbol, u8 src) {
+            declare_var(symbol);
+            return emit(asm_opcode::OP_MOVSD, asm_operand::var(symbol), asm_operand::xmm(src));
+        }
+
+        // Declare a constant in the .rodata section. Its label is derived from its bits, like variables from their
+        // symbol id, so code referring to it does not depend on what else was declared.
+        void declare_literal(f64 value) {
+            const u64 bits = std::bit_cast<u64>(value);
+            if (!literals_.insert(bits).second) {
+                return;  // Already declared
+            }
+            literal_order_.push_back(value);
+        }
+
+        [[nodiscard]] span<const f64> get_literals() const {
+            return literal_order_;
         }
 
         // Check if a variable exists
-        bool has_var(const string& name) const {
-            return var_labels_.find(name) != var_labels_.end();
+        bool has_var(symbol_id symbol) const {
+            return symbol < declared_.size() && declared_[symbol];
         }
 
-        // Print the value on top of stack (consumes it)
-        asm_emitter& emit_print() {
+        // Print a register. Every xmm register is clobbered by the call. rsp never moves after the prologue, so the
+        // stack is already aligned for the call.
+        asm_emitter& emit_print(u8 reg) {
             has_print_ = true;
-            // Save and align stack for printf call
-            code_oss_ << "    ; Print value\n";
-            code_oss_ << "    movsd xmm0, [rsp]\n";  // Get value to print
-            code_oss_ << "    add rsp, 8\n";         // Pop value
-            // Save rbp and align stack
-            code_oss_ << "    push rbp\n";               // Save rbp
-            code_oss_ << "    mov rbp, rsp\n";           // Save current rsp
-            code_oss_ << "    and rsp, -16\n";           // Align to 16 bytes
-            code_oss_ << "    lea rdi, [rel fmt]\n";     // Load format string (RIP-relative)
-            code_oss_ << "    mov eax, 1\n";             // 1 float arg in xmm
-            code_oss_ << "    call printf wrt ..plt\n";  // Call through PLT
-            code_oss_ << "    mov rsp, rbp\n";           // Restore stack
-            code_oss_ << "    pop rbp\n";                // Restore rbp
-            return *this;
+            emit_comment("Print value");
+            emit_load(0, asm_operand::xmm(reg));  // Value to print goes in xmm0
+            if (upper_dirty_) {
+                emit(asm_opcode::OP_VZEROUPPER);  // The print runtime is SSE code
+                upper_dirty_ = false;
+            }
+            return emit(asm_opcode::OP_CALL, asm_operand::label(asm_label::LABEL_PRINT));
         }
 
         // Emit a comment
         asm_emitter& emit_comment(const string& comment) {
-            code_oss_ << "    ; " << comment << "\n";
+            append_comment(code_, comment);
             return *this;
         }
 
-        string get_code() const {
-            std::ostringstream final_oss;
-
-            // Use RIP-relative addressing by default
-            final_oss << "default rel\n\n";
-
-            // Section headers and externals
-            final_oss << "section .text\n";
-            final_oss << "global main\n";
-            if (has_print_) {
-                final_oss << "extern printf\n";
+        /// The whole program as NASM source, one buffer per section in file order. A `freestanding` one also gets a
+        /// `_start` entry point that calls `main` and passes its result to exit_group, for linking without libc's
+        /// startup files.
+        ///
+        /// The emitted code is consumed: its instructions are rewritten in place and released block by block as they
+        /// are written, so it is never held next to a copy of itself or the whole listing.
+        vector<chunked_buffer> take_listing(bool freestanding = false) {
+            const variable_layout layout = get_layout();
+            vector<chunked_buffer> sections(5);
+
+            // Use RIP-relative addressing by default, then section headers and externals
+            std::ostream header_oss(&sections[0]);
+            header_oss << "default rel\n\n";
+            header_oss << "section .text\n";
+            header_oss << "global main\n";
+            if (freestanding) {
+                header_oss << "global _start\n";
             }
-            final_oss << "\n";
-
-            // Data section (format strings, etc.)
             if (has_print_) {
-                final_oss << "section .data\n";
-                final_oss << "    fmt: db \"%.15g\", 10, 0\n";
-                final_oss << "\n";
+                header_oss << "extern " << print_runtime::print_symbol << ", " << print_runtime::flush_symbol << "\n";
+            }
+            header_oss << "\n";
+
+            // Read-only data section (constants used as memory operands)
+            if (!literal_order_.empty()) {
+                std::ostream rodata_oss(&sections[1]);
+                rodata_oss << "section .rodata\n";
+                rodata_oss << "    align 8\n";
+                for (const f64 value : literal_order_) {
+                    rodata_oss << "    ";
+                    asm_renderer::render_literal_label(rodata_oss, value);
+                    rodata_oss << ": dq " << double_to_hex(value) << "\n";
+                }
+                rodata_oss << "\n";
             }
 
-            // BSS section (uninitialized variables)
-            if (!bss_oss_.str().empty()) {
-                final_oss << "section .bss\n";
-                final_oss << bss_oss_.str();
-                final_oss << "\n";
+            // BSS section: one block holding every variable
+            if (!layout.empty()) {
+                std::ostream bss_oss(&sections[2]);
+                bss_oss << "section .bss align=" << variable_layout::cache_line_size << "\n";
+                bss_oss << "    vars: resb " << layout.size() << "\n";
+                bss_oss << "\n";
             }
 
             // Note section for non-executable stack
-            final_oss << "section .note.GNU-stack noalloc noexec nowrite progbits\n\n";
+            std::ostream note_oss(&sections[3]);
+            note_oss << "section .note.GNU-stack noalloc noexec nowrite progbits\n\n";
 
             // Text section with main function
-            final_oss << "section .text\n";
-            final_oss << "main:\n";
-            final_oss << "    push rbp\n";
-            final_oss << "    mov rbp, rsp\n";
-            final_oss << "    sub rsp, 16\n";
-            final_oss << "    and rsp, -16\n\n";
+            const bool vex = target_info::has_avx(arch_);
+            std::ostream text_oss(&sections[4]);
+            text_oss << "section .text\n";
+            asm_renderer::render(text_oss, entry_code(freestanding, layout), layout.offsets(), vex);
+            asm_code body = take_code();
+            rewrite_body(body, layout);
+            asm_renderer::render_releasing(text_oss, std::move(body), layout.offsets(), vex);
+            asm_renderer::render(text_oss, exit_code(layout), layout.offsets(), vex);
+
+            return sections;
+        }
+
+        /// The whole program as a relocatable object file, encoded like NASM would assemble `take_listing`
+        vector<u8> get_object(bool freestanding = false) const {
+            const variable_layout layout = get_layout();
+            const machine_code code      = x86_encoder::encode(program_code(freestanding, layout), layout.offsets(),
+                                                               target_info::has_avx(arch_));
+
+            elf_object object;
+            const data_offsets data = {add_literals(object), 0};
+            if (!layout.empty()) {
+                object.set_bss(layout.size(), variable_layout::cache_line_size);
+            }
+            link_references(object, code, data);
+            return object.serialize();
+        }
+
+        /// The whole program as a static executable that starts at its own `_start`. A program that prints gets the
+        /// prebuilt print runtime for `format` linked in after its code, as the linker would with `--emit=asm`.
+        vector<u8> get_executable(print_format format) const {
+            const variable_layout layout = get_layout();
+            machine_code code =
+                x86_encoder::encode(program_code(true, layout), layout.offsets(), target_info::has_avx(arch_));
+
+            elf_executable executable;
+            const data_offsets data = {add_literals(executable), 0};
+            if (!has_print_) {
+                executable.set_bss(layout.size());
+                resolve_references(executable, code, data, asm_label::LABEL_START);
+                return executable.serialize();
+            }
+
+            // The runtime's .text follows the program's, its .rodata the constants and its .bss the variables
+            const elf_reader runtime = elf_reader::read(print_runtime::object(format));
+            code.bytes.resize((code.bytes.size() + 15) / 16 * 16, 0xCC);
+            const auto text_base = CAST<u32>(code.bytes.size());
+            code.bytes.insert(code.bytes.end(), runtime.text().begin(), runtime.text().end());
+            code.labels.emplace_back(asm_label::LABEL_PRINT, text_base + runtime.function(print_runtime::print_symbol));
+            code.labels.emplace_back(asm_label::LABEL_FLUSH, text_base + runtime.function(print_runtime::flush_symbol));
+
+            const u64 rodata_base = executable.add_rodata(runtime.rodata(), runtime.rodata_alignment());
+            const u64 bss_base    = (layout.size() + runtime.bss_alignment() - 1) / runtime.bss_alignment() *
+                                 runtime.bss_alignment();
+            executable.set_bss(bss_base + runtime.bss_size());
+            resolve_references(executable, code, data, asm_label::LABEL_START);
+
+            using section = elf_object::section;
+            for (const elf_reader::relocation& r : runtime.relocations()) {
+                const u64 base = r.where == section::SECTION_TEXT     ? text_base
+                                 : r.where == section::SECTION_RODATA ? rodata_base
+                                                                      : bss_base;
+                executable.add_relocation(text_base + r.offset, r.where, base + r.target, r.addend);
+            }
+            return executable.serialize();
+        }
+
+        /// The whole program for running in the compiler's process, entered at `main`. Its print runtime calls are
+        /// left for `jit_code::bind_print_runtime`.
+        jit_code get_jit_code() const {
+            const variable_layout layout = get_layout();
+            const machine_code code =
+                x86_encoder::encode(program_code(false, layout), layout.offsets(), target_info::has_avx(arch_));
+
+            jit_code jit;
+            const data_offsets data = {add_literals(jit), 0};
+            jit.set_bss(layout.size());
+            resolve_references(jit, code, data, asm_label::LABEL_MAIN);
+            return jit;
+        }
+
+        /// A program that writes `output` to stdout and exits, for programs evaluated at compile time. It needs no libc
+        /// or startup files: `_start` makes the write and exit_group system calls itself.
+        static vector<chunked_buffer> get_precomputed_code(std::string_view output) {
+            vector<chunked_buffer> sections(4);
+
+            std::ostream header_oss(&sections[0]);
+            header_oss << "default rel\n\n";
+
+            if (!output.empty()) {
+                std::ostream rodata_oss(&sections[1]);
+                rodata_oss << "section .rodata\n";
+                rodata_oss << "    output:";
+                for (size_t i = 0; i < output.size(); ++i) {
+                    rodata_oss << (i % 16 == 0 ? "\n    db " : ", ") << CAST<u32>(CAST<u8>(output[i]));
+                }
+                rodata_oss << "\n\n";
+            }
+
+            std::ostream note_oss(&sections[2]);
+            note_oss << "section .note.GNU-stack noalloc noexec nowrite progbits\n\n";
 
-            // Generated code
-            final_oss << code_oss_.str();
+            std::ostream text_oss(&sections[3]);
+            text_oss << "section .text\n";
+            text_oss << "global _start\n";
+            asm_renderer::render(text_oss, precomputed_code(output), {});
 
-            // Epilogue
-            final_oss << "\n";
-            final_oss << "    ; Exit\n";
-            final_oss << "    mov rsp, rbp\n";
-            final_oss << "    pop rbp\n";
-            final_oss << "    xor eax, eax\n";
-            final_oss << "    ret\n";
+            return sections;
+        }
+
+        /// `get_precomputed_code` as a relocatable object file
+        static vector<u8> get_precomputed_object(std::string_view output) {
+            const machine_code code = x86_encoder::encode(precomputed_code(output), {}, false);
+
+            elf_object object;
+            const data_offsets data = {{}, object.add_rodata(as_bytes(output), 1)};
+            link_references(object, code, data);
+            return object.serialize();
+        }
+
+        /// `get_precomputed_code` as a static executable
+        static vector<u8> get_precomputed_executable(std::string_view output) {
+            const machine_code code = x86_encoder::encode(precomputed_code(output), {}, false);
 
-            return final_oss.str();
+            elf_executable executable;
+            const data_offsets data = {{}, executable.add_rodata(as_bytes(output), 1)};
+            resolve_references(executable, code, data, asm_label::LABEL_START);
+            return executable.serialize();
+        }
+
+        /// The program in the form `emit` asks for: NASM source for `EMIT_ASM`, an object file for `EMIT_OBJECT`, code
+        /// to run in this process for `EMIT_RUN`, otherwise an executable that prints like `format`. NASM source
+        /// consumes the emitted code (see `take_listing`).
+        program_output take_output(emit_kind emit, bool freestanding, print_format format) {
+            program_output output;
+            if (emit == emit_kind::EMIT_ASM) {
+                output.assembly = take_listing(freestanding);
+            } else if (emit == emit_kind::EMIT_OBJECT) {
+                output.object = get_object(freestanding);
+            } else if (emit == emit_kind::EMIT_RUN) {
+                output.jit = get_jit_code();
+            } else {
+                output.executable = get_executable(format);
+            }
+            return output;
         }
 
         void print_variables() const {
-            for (const auto& [name, label] : var_labels_) {
-                std::cout << " - " << name << " (" << label << ")\n";
+            const variable_layout layout = get_layout();
+            for (const symbol_id symbol : var_order_) {
+                std::cout << " - " << symbol_table::global().name(symbol) << " (vars+" << layout.offset(symbol)
+                          << ")\n";
             }
         }
 
-        i32 get_var_count() {
-            return var_count_;
+        // Where each variable goes in the variable block, given the code emitted so far
+        [[nodiscard]] variable_layout get_layout() const {
+            return variable_layout(code_, var_order_, adjacent_);
+        }
+
+        u32 get_var_count() {
+            return CAST<u32>(var_order_.size());
+        }
+
+        // Appends code generated by another emitter (e.g. a cached statement fragment)
+        asm_emitter& append_code(const asm_code& code) {
+            code_.append(code);
+            return *this;
+        }
+
+        // Returns the code emitted so far and starts over with an empty code section
+        asm_code take_code() {
+            asm_code code = std::move(code_);
+            code_.clear();
+            return code;
+        }
+
+        // Runs the peephole optimizer over the code emitted so far, returning the number of instructions removed
+        size_t run_peephole() {
+            return peephole_optimizer::run(code_);
+        }
+
+        // Fuses multiplications with the additions and subtractions using them into FMA instructions where the target
+        // has them, returning the number of instructions removed. The fused result is rounded once, so it can differ
+        // from the separate operations in the last bit.
+        size_t contract_multiply_adds() {
+            return target_info::has_avx(arch_) ? peephole_optimizer::contract_multiply_adds(code_) : 0;
+        }
+
+        [[nodiscard]] bool uses_print() const {
+            return has_print_;
+        }
+
+        void set_uses_print() {
+            has_print_ = true;
         }
 
     private:
-        std::ostringstream code_oss_;               // Main code
-        std::ostringstream bss_oss_;                // BSS section for variables
-        unordered_map<string, string> var_labels_;  // Variable name -> label mapping
-        i32 var_count_;
+        static constexpr u8 floor_temp = 14;  // xmm registers `emit_floor` needs without SSE4.1
+        static constexpr u8 floor_mask = 15;
+
+        asm_code code_;                // Main code
+        std::unordered_set<u64> literals_;  // Bits of every declared constant
+        vector<f64> literal_order_;         // Constants in declaration order
+        vector<bool> declared_;        // Symbol id -> declared yet?
+        vector<symbol_id> var_order_;  // Variables in declaration order
+        vector<std::pair<symbol_id, symbol_id>> adjacent_;  // Variables accessed as a pair, low lane first
+        u32 stack_slots_ = 0;          // 8-byte spill slots the frame needs
+        target_arch arch_;
         bool has_print_;
+        bool upper_dirty_ = false;  // ymm registers may have nonzero upper halves, which slow down SSE code
+
+        asm_emitter& emit(asm_opcode opcode,
+                          const asm_operand& a = {},
+                          const asm_operand& b = {},
+                          const asm_operand& c = {}) {
+            for (const asm_operand* operand : {&a, &b, &c}) {
+                if (operand->kind == operand_kind::OPERAND_LITERAL) {
+                    declare_literal(operand->literal());
+                }
+            }
+            append(code_, opcode, a, b, c);
+            return *this;
+        }
+
+        static asm_operand packed(u8 reg, u8 lanes) {
+            return lanes == 4 ? asm_operand::ymm(reg) : asm_operand::xmm(reg);
+        }
+
+        static void append(asm_code& code,
+                           asm_opcode opcode,
+                           const asm_operand& a = {},
+                           const asm_operand& b = {},
+                           const asm_operand& c = {}) {
+            const u8 count = c.kind != operand_kind::OPERAND_NONE   ? 3
+                             : b.kind != operand_kind::OPERAND_NONE ? 2
+                             : a.kind != operand_kind::OPERAND_NONE ? 1
+                                                                    : 0;
+            code.instructions.push_back({opcode, count, {a, b, c}});
+        }
+
+        static void append_comment(asm_code& code, const string& comment) {
+            code.comments.push_back(comment);
+            append(code, asm_opcode::OP_COMMENT,
+                   asm_operand {operand_kind::OPERAND_NONE, CAST<u32>(code.comments.size() - 1), 0});
+        }
+
+        // The generated code wrapped in `main`, after `_start` if `freestanding`.
+        //
+        // rsp is 16-byte aligned after pushing rbp. rbx (callee-saved, so the print runtime keeps it) holds the
+        // address of the variable block; the frame is sized so rsp is 16-byte aligned again below it and stays that
+        // way. Pair accesses to variables the layout put next to each other become one 16-byte move. With AVX, a
+        // register copy feeding an instruction becomes that instruction's first source instead.
+        asm_code program_code(bool freestanding, const variable_layout& layout) const {
+            asm_code code = entry_code(freestanding, layout);
+
+            // Both rewrites leave the entry point and prologue alone, so the body is copied only once
+            code.append(code_);
+            rewrite_body(code, layout);
+            code.append(exit_code(layout));
+            return code;
+        }
+
+        // `_start` if `freestanding`, then `main` up to the generated code
+        asm_code entry_code(bool freestanding, const variable_layout& layout) const {
+            const auto eax = asm_operand::reg(gpr::GPR_EAX);
+            const auto rbp = asm_operand::reg(gpr::GPR_RBP);
+            const auto rsp = asm_operand::reg(gpr::GPR_RSP);
+            const auto rbx = asm_operand::reg(gpr::GPR_RBX);
+
+            asm_code code;
+            if (freestanding) {
+                // The kernel starts the process with rsp 16-byte aligned, so after the call it is as main expects
+                append(code, asm_opcode::OP_LABEL, asm_operand::label(asm_label::LABEL_START));
+                append(code, asm_opcode::OP_CALL, asm_operand::label(asm_label::LABEL_MAIN));
+                append(code, asm_opcode::OP_MOV, asm_operand::reg(gpr::GPR_EDI), eax);
+                append(code, asm_opcode::OP_MOV, eax, asm_operand::imm(231));  // exit_group
+                append(code, asm_opcode::OP_SYSCALL);
+            }
+
+            const u32 frame_size = get_frame_size(layout);
+            append(code, asm_opcode::OP_LABEL, asm_operand::label(asm_label::LABEL_MAIN));
+            append(code, asm_opcode::OP_PUSH, rbp);
+            append(code, asm_opcode::OP_MOV, rbp, rsp);
+            if (!layout.empty()) {
+                append(code, asm_opcode::OP_PUSH, rbx);
+            }
+            if (frame_size != 0) {
+                append(code, asm_opcode::OP_SUB, rsp, asm_operand::imm(frame_size));
+            }
+            if (!layout.empty()) {
+                append(code, asm_opcode::OP_LEA, rbx, asm_operand::data(asm_label::LABEL_VARS));
+            }
+            return code;
+        }
+
+        // The rest of `main` after the generated code
+        asm_code exit_code(const variable_layout& layout) const {
+            const auto eax = asm_operand::reg(gpr::GPR_EAX);
+            const auto rbp = asm_operand::reg(gpr::GPR_RBP);
+            const auto rsp = asm_operand::reg(gpr::GPR_RSP);
+
+            asm_code code;
+            append_comment(code, "Exit");
+            if (upper_dirty_) {
+                append(code, asm_opcode::OP_VZEROUPPER);
+            }
+            if (has_print_) {
+                append(code, asm_opcode::OP_CALL, asm_operand::label(asm_label::LABEL_FLUSH));  // Buffered prints
+            }
+            if (!layout.empty()) {
+                append(code, asm_opcode::OP_MOV, asm_operand::reg(gpr::GPR_RBX),
+                       asm_operand::stack(get_frame_size(layout)));  // Saved at [rbp - 8]
+            }
+            append(code, asm_opcode::OP_MOV, rsp, rbp);
+            append(code, asm_opcode::OP_POP, rbp);
+            append(code, asm_opcode::OP_XOR, eax, eax);
+            append(code, asm_opcode::OP_RET);
+            return code;
+        }
+
+        // Bytes `main` reserves below the saved registers for spill slots, keeping rsp 16-byte aligned
+        u32 get_frame_size(const variable_layout& layout) const {
+            const u32 saved_size = layout.empty() ? 0 : 8;
+            return ((stack_slots_ * 8 + saved_size + 15) & ~15u) - saved_size;
+        }
+
+        // The rewrites of the generated code that depend on the variable layout and the target, done in place
+        void rewrite_body(asm_code& code, const variable_layout& layout) const {
+            fuse_pair_moves(code, layout);
+            if (target_info::has_avx(arch_)) {
+                peephole_optimizer::fold_register_copies(code);
+            }
+        }
+
+        static asm_code precomputed_code(std::string_view output) {
+            const auto eax = asm_operand::reg(gpr::GPR_EAX);
+            const auto edi = asm_operand::reg(gpr::GPR_EDI);
+
+            asm_code code;
+            append(code, asm_opcode::OP_LABEL, asm_operand::label(asm_label::LABEL_START));
+            if (!output.empty()) {
+                append(code, asm_opcode::OP_MOV, eax, asm_operand::imm(1));  // write
+                append(code, asm_opcode::OP_MOV, edi, asm_operand::imm(1));  // stdout
+                append(code, asm_opcode::OP_LEA, asm_operand::reg(gpr::GPR_RSI),
+                       asm_operand::data(asm_label::LABEL_OUTPUT));
+                append(code, asm_opcode::OP_MOV, asm_operand::reg(gpr::GPR_EDX),
+                       asm_operand::imm(CAST<i64>(output.size())));
+                append(code, asm_opcode::OP_SYSCALL);
+            }
+            append(code, asm_opcode::OP_MOV, eax, asm_operand::imm(231));  // exit_group
+            append(code, asm_opcode::OP_XOR, edi, edi);
+            append(code, asm_opcode::OP_SYSCALL);
+            return code;
+        }
+
+        // Where constants and data went in .rodata
+        struct data_offsets {
+            std::unordered_map<u64, u64> literals;  // Bits -> offset
+            u64 output;                             // The output of a precomputed program
+        };
+
+        static span<const u8> as_bytes(std::string_view text) {
+            return {RCAST<const u8*>(text.data()), text.size()};
+        }
+
+        // Adds every constant to .rodata of `file` (an `elf_object`, `elf_executable` or `jit_code`), returning their
+        // offsets
+        template <typename elf_file>
+        std::unordered_map<u64, u64> add_literals(elf_file& file) const {
+            std::unordered_map<u64, u64> offsets;
+            for (const f64 value : literal_order_) {
+                const u64 bits = std::bit_cast<u64>(value);
+                offsets.emplace(bits, file.add_rodata(span(RCAST<const u8*>(&bits), sizeof(bits)), 8));
+            }
+            return offsets;
+        }
+
+        // The section and offset a constant or data operand refers to
+        static std::pair<elf_object::section, u64> locate(const asm_operand& target, const data_offsets& data) {
+            if (target.kind == operand_kind::OPERAND_LITERAL) {
+                return {elf_object::section::SECTION_RODATA, data.literals.at(target.value)};
+            }
+            if (CAST<asm_label>(target.index) == asm_label::LABEL_VARS) {
+                return {elf_object::section::SECTION_BSS, 0};
+            }
+            return {elf_object::section::SECTION_RODATA, data.output};
+        }
+
+        // Defines the labels of `code` in `object` and turns its references into relocations
+        static void link_references(elf_object& object, const machine_code& code, const data_offsets& data) {
+            using section = elf_object::section;
+            using reloc   = elf_object::relocation_type;
+            object.set_text(code.bytes);
+
+            std::unordered_map<u32, u32> symbols;  // asm_label -> symbol index
+            for (const auto& [label, offset] : code.labels) {
+                symbols[CAST<u32>(label)] =
+                    object.add_global(asm_renderer::label_name(label), section::SECTION_TEXT, offset);
+            }
+            for (const code_reference& reference : code.references) {
+                const asm_operand& target = reference.target;
+                if (target.kind != operand_kind::OPERAND_LABEL) {
+                    const auto [where, offset] = locate(target, data);
+                    object.add_relocation(reference.offset, elf_object::section_symbol(where), reloc::RELOC_PC32,
+                                          CAST<i64>(offset) + reference.addend);
+                    continue;
+                }
+
+                // A call: to a label of this code, or to the print runtime
+                auto symbol = symbols.find(target.index);
+                if (symbol == symbols.end()) {
+                    const char* name = asm_renderer::label_name(CAST<asm_label>(target.index));
+                    const u32 index  = object.add_global(name, section::SECTION_UNDEFINED, 0);
+                    symbol           = symbols.emplace(target.index, index).first;
+                }
+                object.add_relocation(reference.offset, symbol->second, reloc::RELOC_PLT32, reference.addend);
+            }
+        }
+
+        // Fills in the references of `code` in `image` (an `elf_executable` or `jit_code`) and starts it at `entry`.
+        // Only `jit_code` can call labels that `code` does not define.
+        template <typename image_type>
+        static void resolve_references(image_type& image, const machine_code& code, const data_offsets& data,
+                                       asm_label entry) {
+            using section = elf_object::section;
+            image.set_text(code.bytes);
+
+            std::unordered_map<u32, u32> labels;  // asm_label -> offset in .text
+            for (const auto& [label, offset] : code.labels) {
+                labels[CAST<u32>(label)] = offset;
+            }
+            image.set_entry(labels.at(CAST<u32>(entry)));
+            for (const code_reference& reference : code.references) {
+                const asm_operand& target = reference.target;
+                if (target.kind != operand_kind::OPERAND_LABEL) {
+                    const auto [where, offset] = locate(target, data);
+                    image.add_relocation(reference.offset, where, offset, reference.addend);
+                } else if (const auto label = labels.find(target.index); label != labels.end()) {
+                    image.add_relocation(reference.offset, section::SECTION_TEXT, label->second, reference.addend);
+                } else if constexpr (std::is_same_v<image_type, jit_code>) {
+                    image.add_external_call(reference.offset, CAST<asm_label>(target.index), reference.addend);
+                } else {
+                    throw encode_error(string("undefined label: ") +
+                                       asm_renderer::label_name(CAST<asm_label>(target.index)));
+                }
+            }
+        }
+
+        // movsd xmmA, [v]; movhpd xmmA, [v + 8]                =>  movupd xmmA, [v]
+        // movsd [v], xmmA; movhpd [v + 8], xmmA                =>  movupd [v], xmmA
+        // and for the upper pair of four lanes, which goes through a temporary that is not read again:
+        // movupd xmmT, [v]; vinsertf128 ymmA, xmmT, 1          =>  vinsertf128 ymmA, [v], 1
+        // vextractf128 xmmT, ymmA, 1; movupd [v], xmmT         =>  vextractf128 [v], ymmA, 1
+        // movupd xmmA, [v]; vinsertf128 ymmA, [v + 16], 1      =>  movupd ymmA, [v]
+        // movupd [v], xmmA; vextractf128 [v + 16], ymmA, 1     =>  movupd [v], ymmA
+        static void fuse_pair_moves(asm_code& code, const variable_layout& layout) {
+            instruction_list& instructions = code.instructions;
+            size_t out                     = 0;
+            for (const asm_instruction& instruction : instructions) {
+                instructions[out++] = instruction;
+                while (out >= 2 && fuse_moves(instructions[out - 2], instructions[out - 1], layout)) {
+                    --out;
+                }
+            }
+            instructions.truncate(out);
+        }
+
+        // One of the `fuse_pair_moves` rewrites of `prev` and `last` into `prev` alone
+        static bool fuse_moves(asm_instruction& prev, const asm_instruction& last, const variable_layout& layout) {
+            const auto is_var  = [](const asm_operand& operand) { return operand.kind == operand_kind::OPERAND_VAR; };
+            const auto follows = [&](const asm_operand& low, const asm_operand& high, u32 distance) {
+                return is_var(low) && is_var(high) && layout.offset(high.index) == layout.offset(low.index) + distance;
+            };
+            const auto same_register = [](const asm_operand& a, const asm_operand& b) {
+                return a.index == b.index && a.kind != operand_kind::OPERAND_NONE && !a.is_memory() && !b.is_memory();
+            };
+            constexpr u32 slot_size = variable_layout::slot_size;
+            constexpr u32 pair_size = 2 * slot_size;
+
+            if (prev.opcode == asm_opcode::OP_MOVSD && last.opcode == asm_opcode::OP_MOVHPD) {
+                const bool load  = prev.dst() == last.dst() && follows(prev.src(), last.src(), slot_size);
+                const bool store = prev.src() == last.src() && follows(prev.dst(), last.dst(), slot_size);
+                if (load || store) {
+                    prev.opcode = asm_opcode::OP_MOVUPD;
+                    return true;
+                }
+                return false;
+            }
+
+            if (prev.opcode == asm_opcode::OP_MOVUPD && last.opcode == asm_opcode::OP_VINSERTF128) {
+                const asm_operand& lane = last.src();
+                if (is_var(prev.src()) && lane.kind == operand_kind::OPERAND_XMM && prev.dst() == lane &&
+                    lane.index != last.dst().index) {
+                    prev = {asm_opcode::OP_VINSERTF128, 3, {last.dst(), prev.src(), last.operands[2]}};
+                    return true;
+                }
+                if (same_register(prev.dst(), last.dst()) && follows(prev.src(), lane, pair_size)) {
+                    prev.operands[0] = last.dst();
+                    return true;
+                }
+                return false;
+            }
+
+            if (prev.opcode == asm_opcode::OP_VEXTRACTF128 && last.opcode == asm_opcode::OP_MOVUPD) {
+                if (prev.dst().kind == operand_kind::OPERAND_XMM && last.src() == prev.dst() && is_var(last.dst())) {
+                    prev.operands[0] = last.dst();
+                    return true;
+                }
+                return false;
+            }
+
+            if (prev.opcode == asm_opcode::OP_MOVUPD && last.opcode == asm_opcode::OP_VEXTRACTF128 &&
+                same_register(prev.src(), last.src()) && follows(prev.dst(), last.dst(), pair_size)) {
+                prev.operands[1] = last.src();
+                return true;
+            }
+            return false;
+        }
 
         string double_to_hex(f64 value) const {
             union {
@@ -0,0 +1,485 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include "print_runtime.hpp"
+
+#include <bit>
+#include <iomanip>
+#include <ostream>
+#include <type_traits>
+
+namespace mathc {
+    /// @brief What an instruction operand refers to
+    enum class operand_kind : u8 {
+        OPERAND_NONE,
+        OPERAND_XMM,      // register xmm<index>
+        OPERAND_YMM,      // register ymm<index>: xmm<index> widened to four lanes (AVX)
+        OPERAND_GPR,      // general purpose register `gpr(index)`
+        OPERAND_VAR,      // variable with symbol id <index>, in the variable block at rbx
+        OPERAND_LITERAL,  // double constant in .rodata whose bits are `value`
+        OPERAND_STACK,    // [rsp + index]
+        OPERAND_IMM,      // integer immediate `value`
+        OPERAND_LABEL,    // symbol `asm_label(index)`, as a call target
+        OPERAND_DATA,     // [asm_label(index)], memory at a data symbol
+    };
+
+    enum class gpr : u8 {
+        GPR_RAX,
+        GPR_EAX,
+        GPR_RBP,
+        GPR_RSP,
+        GPR_RDI,
+        GPR_RBX,
+        GPR_EDI,
+        GPR_RSI,
+        GPR_EDX,
+    };
+
+    enum class asm_label : u8 {
+        LABEL_PRINT,   // `print_runtime::print_symbol`
+        LABEL_FLUSH,   // `print_runtime::flush_symbol`
+        LABEL_MAIN,    // main, which the C startup files or `_start` call
+        LABEL_START,   // _start, the entry point of programs linked without the C startup files
+        LABEL_VARS,    // the variable block in .bss
+        LABEL_OUTPUT,  // the text a precomputed program writes, in .rodata
+    };
+
+    struct asm_operand {
+        operand_kind kind;
+        u32 index;  // register number, symbol id, stack offset or label
+        u64 value;  // literal bits or immediate
+
+        static asm_operand xmm(u32 reg) {
+            return {operand_kind::OPERAND_XMM, reg, 0};
+        }
+
+        static asm_operand ymm(u32 reg) {
+            return {operand_kind::OPERAND_YMM, reg, 0};
+        }
+
+        static asm_operand reg(gpr r) {
+            return {operand_kind::OPERAND_GPR, CAST<u32>(r), 0};
+        }
+
+        static asm_operand var(u32 symbol) {
+            return {operand_kind::OPERAND_VAR, symbol, 0};
+        }
+
+        static asm_operand constant(f64 value) {
+            return {operand_kind::OPERAND_LITERAL, 0, std::bit_cast<u64>(value)};
+        }
+
+        static asm_operand stack(u32 offset) {
+            return {operand_kind::OPERAND_STACK, offset, 0};
+        }
+
+        static asm_operand imm(i64 value) {
+            return {operand_kind::OPERAND_IMM, 0, CAST<u64>(value)};
+        }
+
+        static asm_operand label(asm_label l) {
+            return {operand_kind::OPERAND_LABEL, CAST<u32>(l), 0};
+        }
+
+        static asm_operand data(asm_label l) {
+            return {operand_kind::OPERAND_DATA, CAST<u32>(l), 0};
+        }
+
+        [[nodiscard]] f64 literal() const {
+            return std::bit_cast<f64>(value);
+        }
+
+        [[nodiscard]] bool is_memory() const {
+            return kind == operand_kind::OPERAND_VAR || kind == operand_kind::OPERAND_LITERAL ||
+                   kind == operand_kind::OPERAND_STACK || kind == operand_kind::OPERAND_DATA;
+        }
+
+        bool operator==(const asm_operand&) const = default;
+    };
+
+    enum class asm_opcode : u8 {
+        OP_MOVSD,
+        OP_MOVAPD,
+        OP_XORPD,
+        OP_ADDSD,
+        OP_SUBSD,
+        OP_MULSD,
+        OP_DIVSD,
+        OP_ROUNDSD,
+        OP_MOVHPD,    // high lane from/to memory
+        OP_MOVUPD,    // both lanes from/to (unaligned) memory
+        OP_UNPCKLPD,  // with the same register twice, copies the low lane to the high one
+        OP_ADDPD,
+        OP_SUBPD,
+        OP_MULPD,
+        OP_DIVPD,
+        OP_ROUNDPD,
+        OP_ANDPD,
+        OP_ANDNPD,        // dst = ~dst & src
+        OP_ORPD,
+        OP_CMPLTSD,       // low lane of dst = all ones if dst < src, else zero
+        OP_CVTTSD2SI,     // gpr = xmm truncated to a 64-bit integer (0x8000000000000000 if out of range)
+        OP_CVTSI2SD,      // low lane of xmm = 64-bit gpr
+        OP_MOVQ,          // 64 bits between a gpr and the low lane of an xmm register
+        OP_VFMADD132SD,   // dst = dst * src2 + src1 (FMA3, like the rest of the group)
+        OP_VFMADD213SD,   // dst = dst * src1 + src2
+        OP_VFMADD231SD,   // dst = src1 * src2 + dst
+        OP_VFMSUB132SD,   // dst = dst * src2 - src1
+        OP_VFMSUB213SD,   // dst = dst * src1 - src2
+        OP_VFNMADD231SD,  // dst = -(src1 * src2) + dst
+        OP_VINSERTF128,   // upper half of ymm dst = src (xmm or memory), lower half kept (AVX, like the next two)
+        OP_VEXTRACTF128,  // dst (xmm or memory) = upper half of ymm src
+        OP_VBROADCASTSD,  // every lane of ymm dst = src (memory)
+        OP_MOV,
+        OP_ADD,
+        OP_SUB,
+        OP_AND,
+        OP_XOR,
+        OP_PUSH,
+        OP_POP,
+        OP_LEA,
+        OP_CALL,
+        OP_RET,
+        OP_SYSCALL,
+        OP_VZEROUPPER,  // clears the upper half of every ymm register, before running code that is not AVX
+        OP_NOP,
+        OP_LABEL,    // defines operands[0] (an OPERAND_LABEL) here
+        OP_COMMENT,  // operands[0].index is the comment's index in `asm_code::comments`
+    };
+
+    /// @brief One instruction in Intel operand order (destination first)
+    struct asm_instruction {
+        asm_opcode opcode;
+        u8 operand_count;
+        array<asm_operand, 3> operands;
+
+        [[nodiscard]] const asm_operand& dst() const {
+            return operands[0];
+        }
+
+        [[nodiscard]] const asm_operand& src() const {
+            return operands[1];
+        }
+    };
+
+    /// @brief A list of instructions stored in fixed-size blocks, like `chunked_buffer` stores text.
+    ///
+    /// Appending never moves the instructions already there, and `consume_blocks` frees each block as soon as it is
+    /// done with, so a long program is never held in full next to what it is turned into. The first block grows as
+    /// needed, so short lists (statement fragments, the prologue) stay small.
+    class instruction_list {
+    public:
+        static constexpr size_t block_size = 1 << 15;  // Instructions per block, about 1.8 MB
+
+        template <bool is_const>
+        class basic_iterator {
+        public:
+            using list_type  = std::conditional_t<is_const, const instruction_list, instruction_list>;
+            using value_type = asm_instruction;
+            using reference  = std::conditional_t<is_const, const asm_instruction&, asm_instruction&>;
+
+            basic_iterator(list_type* list, size_t index) : list_(list), index_(index) {}
+
+            reference operator*() const {
+                return (*list_)[index_];
+            }
+
+            basic_iterator& operator++() {
+                ++index_;
+                return *this;
+            }
+
+            bool operator==(const basic_iterator& other) const {
+                return index_ == other.index_;
+            }
+
+        private:
+            list_type* list_;
+            size_t index_;
+        };
+
+        using iterator       = basic_iterator<false>;
+        using const_iterator = basic_iterator<true>;
+
+        [[nodiscard]] size_t size() const {
+            return size_;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return size_ == 0;
+        }
+
+        asm_instruction& operator[](size_t i) {
+            return blocks_[i / block_size][i % block_size];
+        }
+
+        const asm_instruction& operator[](size_t i) const {
+            return blocks_[i / block_size][i % block_size];
+        }
+
+        void push_back(const asm_instruction& instruction) {
+            if (blocks_.empty() || blocks_.back().size() == block_size) {
+                blocks_.emplace_back();
+                if (blocks_.size() > 1) {
+                    blocks_.back().reserve(block_size);
+                }
+            }
+            blocks_.back().push_back(instruction);
+            ++size_;
+        }
+
+        void pop_back() {
+            blocks_.back().pop_back();
+            if (blocks_.back().empty()) {
+                blocks_.pop_back();
+            }
+            --size_;
+        }
+
+        /// Drops every instruction from `size` on
+        void truncate(size_t size) {
+            while (size_ > size) {
+                pop_back();
+            }
+        }
+
+        void clear() {
+            blocks_.clear();
+            size_ = 0;
+        }
+
+        iterator begin() {
+            return {this, 0};
+        }
+
+        iterator end() {
+            return {this, size_};
+        }
+
+        const_iterator begin() const {
+            return {this, 0};
+        }
+
+        const_iterator end() const {
+            return {this, size_};
+        }
+
+        /// Calls `visit` on each block's instructions in order, freeing the block once it returns. The list is left
+        /// empty.
+        template <typename visitor>
+        void consume_blocks(visitor&& visit) {
+            for (vector<asm_instruction>& block : blocks_) {
+                visit(span<const asm_instruction>(block));
+                vector<asm_instruction>().swap(block);
+            }
+            clear();
+        }
+
+    private:
+        vector<vector<asm_instruction>> blocks_;
+        size_t size_ = 0;
+    };
+
+    /// @brief A sequence of instructions plus the text of the comments among them
+    struct asm_code {
+        instruction_list instructions;
+        vector<string> comments;
+
+        void append(const asm_code& other) {
+            const auto comment_base = CAST<u32>(comments.size());
+            comments.insert(comments.end(), other.comments.begin(), other.comments.end());
+            for (asm_instruction instruction : other.instructions) {
+                if (instruction.opcode == asm_opcode::OP_COMMENT) {
+                    instruction.operands[0].index += comment_base;
+                }
+                instructions.push_back(instruction);
+            }
+        }
+
+        void clear() {
+            instructions.clear();
+            comments.clear();
+        }
+    };
+
+    /// @brief An instruction's operands as they are written out and encoded
+    ///
+    /// With `vex` set, SSE instructions take their VEX-encoded AVX form. Two-operand arithmetic names its destination
+    /// again as the first source (`addsd a, b` is `vaddsd a, a, b`); arithmetic that already has three operands (see
+    /// `peephole_optimizer::fold_register_copies`) is kept as is.
+    struct written_operands {
+        u8 count;
+        array<asm_operand, 4> operands;
+
+        /// SSE instructions, which have a VEX form named with a `v` prefix
+        static bool has_vex_form(asm_opcode opcode) {
+            return opcode <= asm_opcode::OP_MOVQ;
+        }
+
+        static written_operands of(const asm_instruction& instruction, bool vex) {
+            const auto& ops = instruction.operands;
+            if (instruction.opcode == asm_opcode::OP_VINSERTF128) {
+                return {4, {ops[0], ops[0], ops[1], ops[2]}};  // Inserts into dst itself
+            }
+            if (!vex || !has_vex_form(instruction.opcode)) {
+                return {instruction.operand_count, {ops[0], ops[1], ops[2], {}}};
+            }
+
+            const bool d_xmm = ops[0].kind == operand_kind::OPERAND_XMM;
+            switch (instruction.opcode) {
+                case asm_opcode::OP_MOVSD:
+                    if (d_xmm && ops[1].kind == operand_kind::OPERAND_XMM) {
+                        return {3, {ops[0], ops[0], ops[1], {}}};  // vmovsd between registers merges into dst
+                    }
+                    break;
+                case asm_opcode::OP_MOVHPD:
+                    if (d_xmm) {
+                        return {3, {ops[0], ops[0], ops[1], {}}};  // The low lane comes from dst
+                    }
+                    break;
+                case asm_opcode::OP_MOVAPD:
+                case asm_opcode::OP_MOVUPD:
+                case asm_opcode::OP_CVTTSD2SI:
+                case asm_opcode::OP_MOVQ:
+                case asm_opcode::OP_ROUNDPD:
+                    break;
+                case asm_opcode::OP_ROUNDSD:
+                    return {4, {ops[0], ops[1], ops[1], ops[2]}};
+                default:
+                    if (instruction.operand_count == 2) {
+                        return {3, {ops[0], ops[0], ops[1], {}}};
+                    }
+                    break;
+            }
+            return {instruction.operand_count, {ops[0], ops[1], ops[2], {}}};
+        }
+    };
+
+    /// @brief Writes instructions as NASM source, SSE instructions in VEX form with `vex` set (see
+    /// `written_operands`)
+    class asm_renderer {
+    public:
+        /// `var_offsets` maps a variable's symbol id to its byte offset from rbx
+        static void render(std::ostream& out, const asm_code& code, span<const u32> var_offsets, bool vex = false) {
+            for (const asm_instruction& instruction : code.instructions) {
+                render_instruction(out, code, instruction, var_offsets, vex);
+            }
+        }
+
+        /// Like `render`, but frees each block of `code`'s instructions once it is written, so a long listing is never
+        /// held in full next to the instructions it came from. `code` is left empty.
+        static void render_releasing(std::ostream& out, asm_code&& code, span<const u32> var_offsets,
+                                     bool vex = false) {
+            code.instructions.consume_blocks([&](span<const asm_instruction> block) {
+                for (const asm_instruction& instruction : block) {
+                    render_instruction(out, code, instruction, var_offsets, vex);
+                }
+            });
+            code = {};
+        }
+
+        static void render_literal_label(std::ostream& out, f64 value) {
+            out << "lit_" << std::hex << std::setfill('0') << std::setw(16) << std::bit_cast<u64>(value) << std::dec;
+        }
+
+        static const char* label_name(asm_label label) {
+            switch (label) {
+                case asm_label::LABEL_PRINT:
+                    return print_runtime::print_symbol;
+                case asm_label::LABEL_FLUSH:
+                    return print_runtime::flush_symbol;
+                case asm_label::LABEL_MAIN:
+                    return "main";
+                case asm_label::LABEL_START:
+                    return "_start";
+                case asm_label::LABEL_VARS:
+                    return "vars";
+                case asm_label::LABEL_OUTPUT:
+                    return "output";
+            }
+            return "";
+        }
+
+    private:
+        static void render_instruction(std::ostream& out, const asm_code& code, const asm_instruction& instruction,
+                                       span<const u32> var_offsets, bool vex) {
+            if (instruction.opcode == asm_opcode::OP_COMMENT) {
+                out << "    ; " << code.comments[instruction.operands[0].index] << "\n";
+                return;
+            }
+            if (instruction.opcode == asm_opcode::OP_LABEL) {
+                out << label_name(CAST<asm_label>(instruction.operands[0].index)) << ":\n";
+                return;
+            }
+
+            const written_operands written = written_operands::of(instruction, vex);
+            const bool vex_encoded         = vex && written_operands::has_vex_form(instruction.opcode);
+            out << "    " << (vex_encoded ? "v" : "") << mnemonic(instruction.opcode);
+            for (u8 i = 0; i < written.count; ++i) {
+                out << (i == 0 ? " " : ", ");
+                render_operand(out, written.operands[i], var_offsets);
+            }
+            out << "\n";
+        }
+
+        static const char* mnemonic(asm_opcode opcode) {
+            static constexpr const char* names[] = {
+                "movsd",        "movapd",       "xorpd",        "addsd",        "subsd",        "mulsd",
+                "divsd",        "roundsd",      "movhpd",       "movupd",       "unpcklpd",     "addpd",
+                "subpd",        "mulpd",        "divpd",        "roundpd",      "andpd",        "andnpd",
+                "orpd",         "cmpltsd",      "cvttsd2si",    "cvtsi2sd",     "movq",         "vfmadd132sd",
+                "vfmadd213sd",  "vfmadd231sd",  "vfmsub132sd",  "vfmsub213sd",  "vfnmadd231sd", "vinsertf128",
+                "vextractf128", "vbroadcastsd", "mov",          "add",          "sub",          "and",
+                "xor",          "push",         "pop",          "lea",          "call",         "ret",
+                "syscall",      "vzeroupper",   "nop",          "",             "",
+            };
+            return names[CAST<size_t>(opcode)];
+        }
+
+        static void render_operand(std::ostream& out, const asm_operand& operand, span<const u32> var_offsets) {
+            static constexpr const char* gpr_names[] = {"rax", "eax", "rbp", "rsp", "rdi", "rbx", "edi", "rsi", "edx"};
+
+            switch (operand.kind) {
+                case operand_kind::OPERAND_NONE:
+                    break;
+                case operand_kind::OPERAND_XMM:
+                    out << "xmm" << operand.index;
+                    break;
+                case operand_kind::OPERAND_YMM:
+                    out << "ymm" << operand.index;
+                    break;
+                case operand_kind::OPERAND_GPR:
+                    out << gpr_names[operand.index];
+                    break;
+                case operand_kind::OPERAND_VAR:
+                    out << "[rbx";
+                    if (var_offsets[operand.index] != 0) {
+                        out << " + " << var_offsets[operand.index];
+                    }
+                    out << "]";
+                    break;
+                case operand_kind::OPERAND_LITERAL:
+                    out << "[";
+                    render_literal_label(out, operand.literal());
+                    out << "]";
+                    break;
+                case operand_kind::OPERAND_STACK:
+                    out << "[rsp";
+                    if (operand.index != 0) {
+                        out << " + " << operand.index;
+                    }
+                    out << "]";
+                    break;
+                case operand_kind::OPERAND_IMM:
+                    out << CAST<i64>(operand.value);
+                    break;
+                case operand_kind::OPERAND_LABEL:
+                    out << label_name(CAST<asm_label>(operand.index));
+                    break;
+                case operand_kind::OPERAND_DATA:
+                    out << "[" << label_name(CAST<asm_label>(operand.index)) << "]";
+                    break;
+            }
+        }
+    };
+}  // namespace mathc
@@ -9,34 +9,41 @@ namespace mathc {
     class assembler {
     public:
         static i32 run_nasm(const std::string& input_file, const std::string& output_file) {
-            pid_t pid = fork();
-
-            if (pid == -1) {
-                perror("fork");
-                return -1;
-            }
-
-            if (pid == 0) {
-                // Child process - execute NASM
-                execl("/usr/bin/nasm", "nasm", "-f", "elf64", input_file.c_str(), "-o", output_file.c_str(), nullptr);
-
-                // Only reached if exec fails
-                perror("execl");
-                _exit(1);
-            }
+            return run_process("/usr/bin/nasm", {"nasm", "-f", "elf64", input_file.c_str(), "-o", output_file.c_str()});
+        }
 
-            // Parent process - wait for child
-            int status;
-            waitpid(pid, &status, 0);
+        // Links `object_file` with the prebuilt print runtime object `runtime_file`
+        static i32 run_linker(const std::string& object_file,
+                              const std::string& runtime_file,
+                              const std::string& output_exe) {
+            return run_process("/usr/bin/gcc",
+                               {"gcc",
+                                "-no-pie",  // optional
+                                object_file.c_str(), runtime_file.c_str(), "-o", output_exe.c_str()});
+        }
 
-            if (WIFEXITED(status)) {
-                return WEXITSTATUS(status);
-            }
+        // Links `object_file` with the print runtime like `run_linker`, but statically and without libc or startup
+        // files: the object defines `_start` and the runtime makes its own system calls
+        static i32 run_freestanding_linker(const std::string& object_file,
+                                           const std::string& runtime_file,
+                                           const std::string& output_exe) {
+            return run_process("/usr/bin/gcc",
+                               {"gcc", "-nostdlib", "-static", "-no-pie", "-s", "-Wl,--build-id=none",
+                                "-Wl,-z,noseparate-code",  // Code and constants share one page
+                                object_file.c_str(), runtime_file.c_str(), "-o", output_exe.c_str()});
+        }
 
-            return -1;
+        // Links `object_file` on its own into a static executable without libc or startup files; the object defines
+        // `_start` and makes its own system calls
+        static i32 run_standalone_linker(const std::string& object_file, const std::string& output_exe) {
+            return run_process("/usr/bin/gcc", {"gcc", "-nostdlib", "-static", "-no-pie", "-s", "-Wl,--build-id=none",
+                                                object_file.c_str(), "-o", output_exe.c_str()});
         }
 
-        static i32 run_linker(const std::string& object_file, const std::string& output_exe) {
+    private:
+        // Runs `program` with `argv` and waits for it, returning its exit status
+        static i32 run_process(const char* program, vector<const char*> argv) {
+            argv.push_back(nullptr);
             pid_t pid = fork();
 
             if (pid == -1) {
@@ -45,18 +52,14 @@ namespace mathc {
             }
 
             if (pid == 0) {
-                execl("/usr/bin/gcc",
-                      "gcc",
-                      "-no-pie",  // optional
-                      object_file.c_str(),
-                      "-o",
-                      output_exe.c_str(),
-                      nullptr);
+                execv(program, CCAST<char* const*>(argv.data()));
 
-                perror("execl");
+                // Only reached if exec fails
+                perror("execv");
                 _exit(1);
             }
 
+            // Parent process - wait for child
             int status;
             waitpid(pid, &status, 0);
             return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "mathc_common.hpp"
-#include "scanner.hpp"
+#include "token.hpp"
+#include "symbol_table.hpp"
+
+#include <bit>
 
 namespace mathc {
-    enum class ast_node_type {
+    enum class ast_node_type : u8 {
         NODE_NUMBER,
         NODE_BINARY_OP,
         NODE_ASSIGN_OP,
@@ -12,84 +15,182 @@ namespace mathc {
         NODE_PRINT_STMT,
     };
 
+    /// @brief Index of a node within its `ast_program`
+    using ast_ref = u32;
+
+    /// @brief A single 16-byte AST node.
+    ///
+    /// Nodes never own their children; they refer to them by index into the program's node array. The payload
+    /// depends on `type`:
+    ///  - NODE_NUMBER:     `number`
+    ///  - NODE_IDENTIFIER: `symbol`
+    ///  - NODE_BINARY_OP:  `op`, `left`, `right`
+    ///  - NODE_ASSIGN_OP:  `left` (the target identifier), `right` (the value)
+    ///  - NODE_PRINT_STMT: `left` (the printed expression)
     struct ast_node {
         ast_node_type type;
-        virtual ~ast_node()                      = default;
-        virtual void print(i32 indent = 0) const = 0;
-    };
+        token_type op;
 
-    struct ast_number : ast_node {
-        f64 value;
+        union {
+            struct {
+                ast_ref left;
+                ast_ref right;
+            } children;
 
-        ast_number(f64 v) : value(v) {
-            this->type = ast_node_type::NODE_NUMBER;
+            f64 number;
+            symbol_id symbol;
+        };
+
+        [[nodiscard]] ast_ref left() const {
+            return children.left;
         }
 
-        void print(int indent = 0) const override {
-            std::cout << string(indent, ' ') << "Number: " << value << "\n";
+        [[nodiscard]] ast_ref right() const {
+            return children.right;
         }
     };
 
-    struct ast_identifier : ast_node {
-        string value;
+    static_assert(sizeof(ast_node) == 16);
+
+    /// @brief Hashes the `ast_program::canonical` form of a tree
+    struct canonical_hash {
+        size_t operator()(const vector<u64>& words) const {
+            constexpr u64 k = 0x9E3779B97F4A7C15;
+            u64 h           = 0;
+            for (const u64 word : words) {
+                h = (h ^ word) * k;
+                h ^= h >> 31;
+            }
+            return h;
+        }
+    };
 
-        ast_identifier(string v) : value(std::move(v)) {
-            this->type = ast_node_type::NODE_IDENTIFIER;
+    /// @brief A parsed program: every node lives in one contiguous array and statements are indices into it.
+    class ast_program {
+    public:
+        ast_ref add_number(f64 value) {
+            ast_node node {ast_node_type::NODE_NUMBER, token_type::TOKEN_INVALID, {}};
+            node.number = value;
+            return push(node);
         }
 
-        void print(i32 indent = 0) const override {
-            std::cout << string(indent, ' ') << "Identifier: " << value << "\n";
+        ast_ref add_identifier(symbol_id symbol) {
+            ast_node node {ast_node_type::NODE_IDENTIFIER, token_type::TOKEN_INVALID, {}};
+            node.symbol = symbol;
+            return push(node);
         }
-    };
 
-    struct ast_print_stmt : ast_node {
-        unique_ptr<ast_node> expr;
+        ast_ref add_binary_op(ast_ref left, token_type op, ast_ref right) {
+            return push({ast_node_type::NODE_BINARY_OP, op, {{left, right}}});
+        }
 
-        ast_print_stmt(unique_ptr<ast_node> e) : expr(std::move(e)) {
-            this->type = ast_node_type::NODE_PRINT_STMT;
+        ast_ref add_assign_op(ast_ref target, ast_ref value) {
+            return push({ast_node_type::NODE_ASSIGN_OP, token_type::TOKEN_INVALID, {{target, value}}});
         }
 
-        void print(i32 indent = 0) const override {
-            std::cout << string(indent, ' ') << "Print: \n";
-            expr->print(indent + 4);
+        ast_ref add_print_stmt(ast_ref expr) {
+            return push({ast_node_type::NODE_PRINT_STMT, token_type::TOKEN_INVALID, {{expr, 0}}});
+        }
+
+        void reserve(size_t node_count) {
+            nodes_.reserve(node_count);
         }
-    };
 
-    struct ast_assign_op : ast_node {
-        unique_ptr<ast_node> left;
-        unique_ptr<ast_node> right;
+        void add_statement(ast_ref root) {
+            statements_.push_back(root);
+        }
 
-        ast_assign_op(unique_ptr<ast_node> l, unique_ptr<ast_node> r) : left(std::move(l)), right(std::move(r)) {
-            this->type = ast_node_type::NODE_ASSIGN_OP;
+        [[nodiscard]] const ast_node& operator[](ast_ref ref) const {
+            return nodes_[ref];
         }
 
-        void print(i32 indent = 0) const override {
-            std::cout << string(indent, ' ') << "AssignOp: \n";
-            std::cout << string(indent, ' ') << "  Left:\n";
-            left->print(indent + 4);
-            std::cout << string(indent, ' ') << "  Right:\n";
-            right->print(indent + 4);
+        [[nodiscard]] span<const ast_ref> statements() const {
+            return statements_;
         }
-    };
 
-    struct ast_binary_op : ast_node {
-        unique_ptr<ast_node> left;
-        unique_ptr<ast_node> right;
-        token_type op;
+        [[nodiscard]] size_t node_count() const {
+            return nodes_.size();
+        }
 
-        ast_binary_op(unique_ptr<ast_node> l, token_type o, unique_ptr<ast_node> r)
-            : left(std::move(l)), right(std::move(r)), op(o) {
-            this->type = ast_node_type::NODE_BINARY_OP;
+        void clear() {
+            nodes_.clear();
+            statements_.clear();
         }
 
-        void print(int indent = 0) const override {
-            std::cout << string(indent, ' ') << "BinaryOp: " << token::token_type_to_str(op) << "\n";
-            std::cout << string(indent, ' ') << "  Left:\n";
-            left->print(indent + 4);
-            std::cout << string(indent, ' ') << "  Right:\n";
-            right->print(indent + 4);
+        /// The shape and contents of the tree rooted at `root` as a list of words: each node's type and operator, then
+        /// its number or symbol, in pre-order. Two trees have the same list exactly when they are equal, wherever they
+        /// are stored.
+        [[nodiscard]] vector<u64> canonical(ast_ref root) const {
+            vector<u64> words;
+            vector<ast_ref> pending {root};
+            while (!pending.empty()) {
+                const ast_node& node = nodes_[pending.back()];
+                pending.pop_back();
+
+                u64 payload = 0;
+                switch (node.type) {
+                    case ast_node_type::NODE_NUMBER:
+                        payload = std::bit_cast<u64>(node.number);
+                        break;
+                    case ast_node_type::NODE_IDENTIFIER:
+                        payload = node.symbol;
+                        break;
+                    case ast_node_type::NODE_PRINT_STMT:
+                        pending.push_back(node.left());
+                        break;
+                    case ast_node_type::NODE_BINARY_OP:
+                    case ast_node_type::NODE_ASSIGN_OP:
+                        pending.push_back(node.right());
+                        pending.push_back(node.left());
+                        break;
+                }
+
+                words.push_back(CAST<u64>(node.type) << 8 | CAST<u64>(node.op));
+                words.push_back(payload);
+            }
+            return words;
+        }
+
+        void print(ast_ref ref, i32 indent = 0) const {
+            const ast_node& node = nodes_[ref];
+            const string pad(indent, ' ');
+            switch (node.type) {
+                case ast_node_type::NODE_NUMBER:
+                    std::cout << pad << "Number: " << node.number << "\n";
+                    break;
+                case ast_node_type::NODE_IDENTIFIER:
+                    std::cout << pad << "Identifier: " << symbol_table::global().name(node.symbol) << "\n";
+                    break;
+                case ast_node_type::NODE_PRINT_STMT:
+                    std::cout << pad << "Print: \n";
+                    print(node.left(), indent + 4);
+                    break;
+                case ast_node_type::NODE_ASSIGN_OP:
+                    std::cout << pad << "AssignOp: \n";
+                    std::cout << pad << "  Left:\n";
+                    print(node.left(), indent + 4);
+                    std::cout << pad << "  Right:\n";
+                    print(node.right(), indent + 4);
+                    break;
+                case ast_node_type::NODE_BINARY_OP:
+                    std::cout << pad << "BinaryOp: " << token::token_type_to_str(node.op) << "\n";
+                    std::cout << pad << "  Left:\n";
+                    print(node.left(), indent + 4);
+                    std::cout << pad << "  Right:\n";
+                    print(node.right(), indent + 4);
+                    break;
+            }
+        }
+
+    private:
+        vector<ast_node> nodes_;
+        vector<ast_ref> statements_;
+
+        ast_ref push(const ast_node& node) {
+            nodes_.push_back(node);
+            return CAST<ast_ref>(nodes_.size() - 1);
         }
     };
 
-    using mathc_program = vector<unique_ptr<ast_node>>;
+    using mathc_program = ast_program;
 }  // namespace mathc
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "mathc_common.hpp"
+
+namespace mathc {
+    /// @brief Appends little-endian integers to a byte buffer, for writing ELF files
+    class byte_writer {
+    public:
+        explicit byte_writer(vector<u8>& out) : out_(out) {}
+
+        template <typename T>
+        void put(T value) {
+            for (size_t i = 0; i < sizeof(T); ++i) {
+                out_.push_back(CAST<u8>(CAST<u64>(value) >> (8 * i)));
+            }
+        }
+
+        void pad_to(u64 alignment) {
+            while (out_.size() % alignment != 0) {
+                out_.push_back(0);
+            }
+        }
+
+    private:
+        vector<u8>& out_;
+    };
+}  // namespace mathc
@@ -0,0 +1,313 @@
+#include "bytecode.hpp"
+#include "codegen.hpp"
+#include "print_runtime.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <unordered_map>
+
+namespace mathc {
+    namespace {
+        // While lowering, the sizes of the register ranges are not known yet, so an operand is its range in the top
+        // two bits and its index within the range. The final register numbers replace them at the end.
+        constexpr u32 RANGE_CONSTANT  = 0u << 30;
+        constexpr u32 RANGE_VARIABLE  = 1u << 30;
+        constexpr u32 RANGE_TEMPORARY = 2u << 30;
+        constexpr u32 RANGE_MASK      = 3u << 30;
+        constexpr u32 NO_TARGET       = ~0u;
+
+        struct work_item {
+            ast_ref ref;
+            bool finish;  // operands are done
+            u32 target;   // operand to compute a binary operation into, instead of a new temporary
+        };
+
+        bc_opcode binary_opcode(token_type op) {
+            switch (op) {
+                case token_type::TOKEN_ADD:
+                    return bc_opcode::BC_ADD;
+                case token_type::TOKEN_SUBTRACT:
+                    return bc_opcode::BC_SUB;
+                case token_type::TOKEN_MULTIPLY:
+                    return bc_opcode::BC_MUL;
+                case token_type::TOKEN_DIVIDE:
+                    return bc_opcode::BC_DIV;
+                case token_type::TOKEN_FLOOR_DIV:
+                    return bc_opcode::BC_FLOOR_DIV;
+                case token_type::TOKEN_MODULO:
+                    return bc_opcode::BC_MOD;
+                default:
+                    throw codegen_error("Unknown binary operator");
+            }
+        }
+
+        const char* opcode_name(bc_opcode opcode) {
+            static constexpr const char* names[] = {"move", "add", "sub", "mul", "div", "floordiv", "mod", "print",
+                                                    "halt"};
+            return names[CAST<size_t>(opcode)];
+        }
+    }  // namespace
+
+    bytecode_program bytecode_program::from_ast(const mathc_program& program) {
+        bytecode_program out;
+        std::unordered_map<u64, u32> constants;  // Bits -> index
+        vector<u32> variables;                   // Symbol id -> index + 1, or 0
+        vector<bool> assigned;                   // Symbol id -> readable yet?
+        vector<symbol_id> statement_stores;
+        vector<work_item> work;
+        vector<u32> results;
+        u32 temporaries = 0;  // In use by the current statement
+
+        const auto constant = [&](f64 value) {
+            const auto [entry, added] = constants.emplace(std::bit_cast<u64>(value), CAST<u32>(out.constants_.size()));
+            if (added) {
+                out.constants_.push_back(value);
+            }
+            return RANGE_CONSTANT | entry->second;
+        };
+        const auto variable = [&](symbol_id symbol) {
+            if (symbol >= variables.size()) {
+                variables.resize(symbol + 1, 0);
+            }
+            if (variables[symbol] == 0) {
+                out.variables_.push_back(symbol);
+                variables[symbol] = CAST<u32>(out.variables_.size());
+            }
+            return RANGE_VARIABLE | (variables[symbol] - 1);
+        };
+        const auto release = [&temporaries](u32 operand) {
+            // Operands are released in the reverse order of their allocation, so temporaries form a stack
+            if ((operand & RANGE_MASK) == RANGE_TEMPORARY) {
+                --temporaries;
+            }
+        };
+
+        for (const ast_ref root : program.statements()) {
+            const size_t statement_start = out.code_.size();
+
+            // Post-order walk on an explicit stack, operands in source order, so the first error reported is the
+            // leftmost one as in code generation
+            work.push_back({root, false, NO_TARGET});
+            while (!work.empty()) {
+                const work_item item = work.back();
+                work.pop_back();
+
+                const ast_node& node = program[item.ref];
+                if (!item.finish) {
+                    switch (node.type) {
+                        case ast_node_type::NODE_BINARY_OP:
+                            work.push_back({item.ref, true, item.target});
+                            work.push_back({node.right(), false, NO_TARGET});
+                            work.push_back({node.left(), false, NO_TARGET});
+                            continue;
+                        case ast_node_type::NODE_ASSIGN_OP: {
+                            const ast_node& target = program[node.left()];
+                            const ast_node& value  = program[node.right()];
+                            const bool direct      = target.type == ast_node_type::NODE_IDENTIFIER &&
+                                                value.type == ast_node_type::NODE_BINARY_OP;
+                            work.push_back({item.ref, true, NO_TARGET});
+                            work.push_back({node.right(), false, direct ? variable(target.symbol) : NO_TARGET});
+                            continue;
+                        }
+                        case ast_node_type::NODE_PRINT_STMT:
+                            work.push_back({item.ref, true, NO_TARGET});
+                            work.push_back({node.left(), false, NO_TARGET});
+                            continue;
+                        default:
+                            break;
+                    }
+                }
+
+                switch (node.type) {
+                    case ast_node_type::NODE_NUMBER:
+                        results.push_back(constant(node.number));
+                        break;
+                    case ast_node_type::NODE_IDENTIFIER:
+                        if (node.symbol >= assigned.size() || !assigned[node.symbol]) {
+                            throw codegen_error("Undefined variable: " +
+                                                string(symbol_table::global().name(node.symbol)));
+                        }
+                        results.push_back(variable(node.symbol));
+                        break;
+                    case ast_node_type::NODE_BINARY_OP: {
+                        const u32 right = results.back();
+                        results.pop_back();
+                        const u32 left = results.back();
+                        results.pop_back();
+                        release(right);
+                        release(left);
+
+                        u32 dst = item.target;
+                        if (dst == NO_TARGET) {
+                            dst              = RANGE_TEMPORARY | temporaries++;
+                            out.temporaries_ = std::max(out.temporaries_, temporaries);
+                        }
+                        out.code_.push_back({binary_opcode(node.op), dst, left, right});
+                        results.push_back(dst);
+                        break;
+                    }
+                    case ast_node_type::NODE_ASSIGN_OP: {
+                        const ast_node& target = program[node.left()];
+                        if (target.type != ast_node_type::NODE_IDENTIFIER) {
+                            throw codegen_error("Left side of assignment must be an identifier");
+                        }
+                        const u32 home  = variable(target.symbol);
+                        const u32 value = results.back();
+                        results.pop_back();
+                        if (value != home) {
+                            out.code_.push_back({bc_opcode::BC_MOVE, home, value, 0});
+                            release(value);
+                        }
+                        results.push_back(home);
+                        statement_stores.push_back(target.symbol);
+                        break;
+                    }
+                    case ast_node_type::NODE_PRINT_STMT:
+                        // `print(e)` evaluates to `e`, which stays on the result stack
+                        out.code_.push_back({bc_opcode::BC_PRINT, 0, results.back(), 0});
+                        break;
+                }
+            }
+
+            // A statement that neither assigns nor prints has no effect
+            const ast_node_type root_type = program[root].type;
+            if (root_type != ast_node_type::NODE_ASSIGN_OP && root_type != ast_node_type::NODE_PRINT_STMT) {
+                out.code_.resize(statement_start);
+            }
+            results.clear();
+            temporaries = 0;
+
+            // Variables become readable from the next statement on, as with `asm_emitter::has_var`
+            for (const symbol_id symbol : statement_stores) {
+                if (symbol >= assigned.size()) {
+                    assigned.resize(symbol + 1);
+                }
+                assigned[symbol] = true;
+            }
+            statement_stores.clear();
+        }
+        out.code_.push_back({bc_opcode::BC_HALT, 0, 0, 0});
+
+        const u32 variable_base  = CAST<u32>(out.constants_.size());
+        const u32 temporary_base = variable_base + CAST<u32>(out.variables_.size());
+        const auto number        = [&](u32 operand) {
+            const u32 index = operand & ~RANGE_MASK;
+            switch (operand & RANGE_MASK) {
+                case RANGE_VARIABLE:
+                    return variable_base + index;
+                case RANGE_TEMPORARY:
+                    return temporary_base + index;
+                default:
+                    return index;
+            }
+        };
+        for (bc_instruction& instruction : out.code_) {
+            instruction.dst = number(instruction.dst);
+            instruction.a   = number(instruction.a);
+            instruction.b   = number(instruction.b);
+        }
+        return out;
+    }
+
+// Threaded dispatch: every handler ends by jumping straight to the next instruction's handler, through a table
+// indexed by its opcode, so each handler's indirect jump gets its own branch prediction. Labels as values and
+// computed gotos are GNU extensions.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+    void bytecode_program::run(print_format format) const {
+        vector<f64> registers(register_count());
+        std::copy(constants_.begin(), constants_.end(), registers.begin());
+        f64* const r = registers.data();
+
+        print_buffer output(format);
+        static constexpr const void* handlers[] = {
+            &&op_move, &&op_add, &&op_sub, &&op_mul, &&op_div, &&op_floor_div, &&op_mod, &&op_print, &&op_halt,
+        };
+        static_assert(std::size(handlers) == CAST<size_t>(bc_opcode::BC_HALT) + 1);
+
+        const bc_instruction* ip = code_.data();
+    #define MATHC_DISPATCH() goto* handlers[CAST<size_t>(ip->opcode)]
+    #define MATHC_NEXT()     \
+        ++ip;                \
+        MATHC_DISPATCH()
+
+        MATHC_DISPATCH();
+
+    op_move:
+        r[ip->dst] = r[ip->a];
+        MATHC_NEXT();
+    op_add:
+        r[ip->dst] = r[ip->a] + r[ip->b];
+        MATHC_NEXT();
+    op_sub:
+        r[ip->dst] = r[ip->a] - r[ip->b];
+        MATHC_NEXT();
+    op_mul:
+        r[ip->dst] = r[ip->a] * r[ip->b];
+        MATHC_NEXT();
+    op_div:
+        r[ip->dst] = r[ip->a] / r[ip->b];
+        MATHC_NEXT();
+    op_floor_div:
+        // Like `asm_emitter::emit_floor_div`: round the quotient down
+        r[ip->dst] = std::floor(r[ip->a] / r[ip->b]);
+        MATHC_NEXT();
+    op_mod: {
+        // Like `asm_emitter::emit_mod`, each step rounded on its own
+        const f64 a       = r[ip->a];
+        const f64 b       = r[ip->b];
+        const f64 product = std::floor(a / b) * b;
+        r[ip->dst]        = a - product;
+        MATHC_NEXT();
+    }
+    op_print:
+        output.print(r[ip->a]);
+        MATHC_NEXT();
+    op_halt:
+        return;
+
+    #undef MATHC_NEXT
+    #undef MATHC_DISPATCH
+    }
+
+#pragma GCC diagnostic pop
+
+    void bytecode_program::print(std::ostream& out) const {
+        const auto old_precision = out.precision(17);
+
+        u32 reg = 0;
+        for (const f64 value : constants_) {
+            out << "    r" << reg++ << " = " << value << "\n";
+        }
+        for (const symbol_id symbol : variables_) {
+            out << "    r" << reg++ << " = " << symbol_table::global().name(symbol) << "\n";
+        }
+        if (temporaries_ != 0) {
+            out << "    r" << reg << (temporaries_ > 1 ? "..r" + std::to_string(reg + temporaries_ - 1) : "")
+                << " = temporaries\n";
+        }
+        out << "\n";
+
+        for (size_t i = 0; i < code_.size(); ++i) {
+            const bc_instruction& instruction = code_[i];
+            out << "    " << i << ": " << opcode_name(instruction.opcode);
+            switch (instruction.opcode) {
+                case bc_opcode::BC_PRINT:
+                    out << " r" << instruction.a;
+                    break;
+                case bc_opcode::BC_MOVE:
+                    out << " r" << instruction.dst << ", r" << instruction.a;
+                    break;
+                case bc_opcode::BC_HALT:
+                    break;
+                default:
+                    out << " r" << instruction.dst << ", r" << instruction.a << ", r" << instruction.b;
+                    break;
+            }
+            out << "\n";
+        }
+
+        out.precision(old_precision);
+    }
+}  // namespace mathc
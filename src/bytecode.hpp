@@ -0,0 +1,63 @@
+#pragma once
+
+#include "ast.hpp"
+#include "options.hpp"
+
+#include <ostream>
+
+namespace mathc {
+    /// @brief Operations of the `--interpret` bytecode. Operands are register numbers.
+    enum class bc_opcode : u8 {
+        BC_MOVE,       // `dst` = `a`
+        BC_ADD,        // `dst` = `a` + `b`
+        BC_SUB,        // `dst` = `a` - `b`
+        BC_MUL,        // `dst` = `a` * `b`
+        BC_DIV,        // `dst` = `a` / `b`
+        BC_FLOOR_DIV,  // `dst` = floor(`a` / `b`)
+        BC_MOD,        // `dst` = `a` - floor(`a` / `b`) * `b`
+        BC_PRINT,      // print `a`
+        BC_HALT,       // end of the program
+    };
+
+    struct bc_instruction {
+        bc_opcode opcode;
+        u32 dst;
+        u32 a;
+        u32 b;
+    };
+
+    static_assert(sizeof(bc_instruction) == 16);
+
+    /// @brief A program as register-based bytecode, run by an interpreter instead of compiled to machine code.
+    ///
+    /// Every value lives in a register: the program's constants come first, loaded before it starts, then one register
+    /// per variable, then the temporaries of expressions, which are reused from statement to statement. Each
+    /// operation reads its operand registers before writing `dst`, so an assignment's expression computes straight
+    /// into the variable's register. Values are computed one IEEE double operation at a time like the generated code
+    /// does, so both print the same.
+    class bytecode_program {
+    public:
+        /// Lowers an AST, reporting reads of unassigned variables and assignments to non-variables the same way code
+        /// generation does (as `codegen_error`)
+        static bytecode_program from_ast(const mathc_program& program);
+
+        /// Runs the program, printing values like the print runtime formatting them as `format`
+        void run(print_format format) const;
+
+        void print(std::ostream& out) const;
+
+        [[nodiscard]] span<const bc_instruction> instructions() const {
+            return code_;
+        }
+
+    private:
+        vector<bc_instruction> code_;
+        vector<f64> constants_;        // Initial values of the first registers
+        vector<symbol_id> variables_;  // Variable in each register after the constants
+        u32 temporaries_ = 0;          // Registers after the variables
+
+        [[nodiscard]] u32 register_count() const {
+            return CAST<u32>(constants_.size() + variables_.size()) + temporaries_;
+        }
+    };
+}  // namespace mathc
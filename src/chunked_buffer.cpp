@@ -0,0 +1,97 @@
+#include "chunked_buffer.hpp"
+
+#include <cerrno>
+#include <climits>
+#include <new>
+#include <sys/uio.h>
+
+namespace mathc {
+    chunked_buffer::chunked_buffer(chunked_buffer&& other) noexcept
+        : std::streambuf(other), blocks_(std::move(other.blocks_)), full_size_(other.full_size_) {
+        other.setp(nullptr, nullptr);
+        other.full_size_ = 0;
+    }
+
+    chunked_buffer& chunked_buffer::operator=(chunked_buffer&& other) noexcept {
+        if (this != &other) {
+            std::streambuf::operator=(other);
+            blocks_    = std::move(other.blocks_);
+            full_size_ = other.full_size_;
+            other.setp(nullptr, nullptr);
+            other.full_size_ = 0;
+        }
+        return *this;
+    }
+
+    vector<std::string_view> chunked_buffer::blocks() const {
+        vector<std::string_view> views;
+        views.reserve(blocks_.size());
+        for (size_t i = 0; i < blocks_.size(); ++i) {
+            const bool last = i + 1 == blocks_.size();
+            views.emplace_back(blocks_[i].get(), last ? CAST<size_t>(pptr() - pbase()) : block_size);
+        }
+        return views;
+    }
+
+    bool chunked_buffer::write_to(int fd, span<const chunked_buffer> buffers) {
+        vector<iovec> pending;
+        for (const chunked_buffer& buffer : buffers) {
+            for (const std::string_view block : buffer.blocks()) {
+                pending.push_back({CCAST<char*>(block.data()), block.size()});
+            }
+        }
+
+        // One call normally writes everything; a short write resumes from where it stopped
+        size_t first = 0;
+        while (first < pending.size()) {
+            if (pending[first].iov_len == 0) {
+                ++first;
+                continue;
+            }
+            const int count      = CAST<int>(std::min<size_t>(pending.size() - first, IOV_MAX));
+            const ssize_t result = writev(fd, pending.data() + first, count);
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return false;
+            }
+            if (result == 0) {
+                errno = EIO;
+                return false;
+            }
+
+            auto written = CAST<size_t>(result);
+            while (written != 0) {
+                const size_t step = std::min(written, pending[first].iov_len);
+                pending[first].iov_base = CAST<char*>(pending[first].iov_base) + step;
+                pending[first].iov_len -= step;
+                written -= step;
+                if (pending[first].iov_len == 0) {
+                    ++first;
+                }
+            }
+        }
+        return true;
+    }
+
+    chunked_buffer::int_type chunked_buffer::overflow(int_type ch) {
+        if (traits_type::eq_int_type(ch, traits_type::eof())) {
+            return traits_type::not_eof(ch);
+        }
+
+        auto* const block = CAST<char*>(std::aligned_alloc(block_size, block_size));
+        if (block == nullptr) {
+            throw std::bad_alloc();
+        }
+        if (!blocks_.empty()) {
+            full_size_ += block_size;
+        }
+        blocks_.emplace_back(block);
+        setp(block, block + block_size);
+
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+        return ch;
+    }
+}  // namespace mathc
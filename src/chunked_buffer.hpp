@@ -0,0 +1,64 @@
+#pragma once
+
+#include "mathc_common.hpp"
+
+#include <cstdlib>
+#include <memory>
+#include <streambuf>
+
+namespace mathc {
+    /// @brief An append-only text buffer made of fixed-size blocks, for output too large to copy around.
+    ///
+    /// Blocks are 2 MiB and aligned to their size, so the kernel can back each with one huge page, and are never
+    /// reallocated: writing past the end of the last block starts a new one instead of moving what is already there.
+    /// It is a stream buffer, so a `std::ostream` on it writes straight into the blocks, and `write_to` hands them all
+    /// to writev(2) without ever concatenating them, together with those of any other buffers written alongside it
+    /// (say, one per section of a listing).
+    class chunked_buffer : public std::streambuf {
+    public:
+        static constexpr size_t block_size = 2 * 1024 * 1024;
+
+        chunked_buffer() = default;
+
+        chunked_buffer(chunked_buffer&& other) noexcept;
+        chunked_buffer& operator=(chunked_buffer&& other) noexcept;
+        chunked_buffer(const chunked_buffer&)            = delete;
+        chunked_buffer& operator=(const chunked_buffer&) = delete;
+
+        void append(std::string_view text) {
+            sputn(text.data(), CAST<std::streamsize>(text.size()));
+        }
+
+        [[nodiscard]] size_t size() const {
+            return full_size_ + CAST<size_t>(pptr() - pbase());
+        }
+
+        [[nodiscard]] bool empty() const {
+            return size() == 0;
+        }
+
+        /// The text in each block, in order
+        [[nodiscard]] vector<std::string_view> blocks() const;
+
+        /// Writes everything to `fd`, returning false (with errno set) if that fails
+        [[nodiscard]] bool write_to(int fd) const {
+            return write_to(fd, span(this, 1));
+        }
+
+        /// Writes every buffer in `buffers` to `fd` in order, like `write_to` on each but in one writev(2) call
+        [[nodiscard]] static bool write_to(int fd, span<const chunked_buffer> buffers);
+
+    protected:
+        int_type overflow(int_type ch) override;
+
+    private:
+        struct block_deleter {
+            void operator()(char* block) const {
+                std::free(block);
+            }
+        };
+
+        vector<std::unique_ptr<char, block_deleter>> blocks_;
+        size_t full_size_ = 0;  // Bytes in every block but the last, which are all full
+    };
+}  // namespace mathc
@@ -1,122 +1,659 @@
 #include "codegen.hpp"
 #include "ast.hpp"
 
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <sstream>
+
 namespace mathc {
+    namespace {
+        /// 1 / `divisor` if `divisor` is a power of two (or its negation) whose reciprocal is a double too
+        optional<f64> exact_reciprocal(f64 divisor) {
+            i32 exponent         = 0;
+            const f64 mantissa   = std::frexp(divisor, &exponent);
+            const f64 reciprocal = 1.0 / divisor;
+            if (std::fabs(mantissa) != 0.5 || !std::isfinite(reciprocal) || reciprocal * divisor != 1.0) {
+                return std::nullopt;
+            }
+            return reciprocal;
+        }
+
+        bool is_commutative(token_type op) {
+            // Exact in IEEE arithmetic; all NaNs the generated code can produce are the same default NaN
+            return op == token_type::TOKEN_ADD || op == token_type::TOKEN_MULTIPLY;
+        }
+    }  // namespace
+
     void code_generator::generate_program(const mathc_program& program) {
-        for (const auto& node : program) {
-            generate(node.get());
+        program_                             = &program;
+        const span<const ast_ref> statements = program.statements();
+        for (size_t i = 0; i < statements.size(); ++i) {
+            statement_index_ = CAST<u32>(i);
+            // Four statements at a time where ymm registers can take them, else two
+            const span<const ast_ref> rest = statements.subspan(i);
+            if (options_.vectorize && target_info::has_avx(options_.arch) && rest.size() >= 4 &&
+                can_pack(rest.first(4))) {
+                generate_pack(rest.first(4));
+                i += 3;
+                continue;
+            }
+            if (options_.vectorize && rest.size() >= 2 && can_pack(rest.first(2))) {
+                generate_pack(rest.first(2));
+                ++i;
+                continue;
+            }
+            generate(statements[i]);
+        }
+    }
+
+    statement_code code_generator::generate_statement(const mathc_program& program, ast_ref ref) {
+        statement_code fragment {};
+        asm_emitter_ = asm_emitter(options_.arch);
+        program_     = &program;
+        fragment_    = &fragment;
+        generate(ref);
+        fragment_ = nullptr;
+
+        fragment.code        = asm_emitter_.take_code();
+        fragment.prints      = asm_emitter_.uses_print();
+        fragment.stack_slots = asm_emitter_.get_stack_slots();
+        const auto literals  = asm_emitter_.get_literals();
+        fragment.literals.assign(literals.begin(), literals.end());
+        return fragment;
+    }
+
+    void code_generator::generate(ast_ref ref) {
+        label(ref);
+
+        // Post-order walk on an explicit stack: each node is revisited after each operand it evaluates, so
+        // expression depth never turns into native call depth
+        work_.clear();
+        work_.push_back({ref, stage::STAGE_START, false});
+
+        while (!work_.empty()) {
+            const work_item item = work_.back();
+            work_.pop_back();
+
+            const ast_node& node = (*program_)[item.ref];
+            if (item.step == stage::STAGE_START) {
+                // Make room for the whole subtree up front, so spills happen as high in the tree as possible
+                ensure_free(std::min<u32>(need_[item.ref], register_count_));
+            }
+
+            switch (node.type) {
+                case ast_node_type::NODE_NUMBER:
+                case ast_node_type::NODE_IDENTIFIER:
+                    generate_leaf(item);
+                    break;
+                case ast_node_type::NODE_BINARY_OP:
+                    generate_binary_op(item);
+                    break;
+                case ast_node_type::NODE_ASSIGN_OP:
+                    generate_assign_op(item);
+                    break;
+                case ast_node_type::NODE_PRINT_STMT:
+                    generate_print_stmt(item);
+                    break;
+                default:
+                    throw codegen_error("Unknown AST node type");
+            }
         }
     }
 
-    void code_generator::generate(ast_node* node) {
-        switch (node->type) {
-            case ast_node_type::NODE_NUMBER: {
-                auto* number = DCAST<ast_number*>(node);
-                if (!number) {
-                    throw codegen_error("Could not cast ast_node to ast_number");
+    void code_generator::label(ast_ref root) {
+        if (need_.size() < program_->node_count()) {
+            need_.resize(program_->node_count());
+            integral_.resize(program_->node_count());
+        }
+
+        // Operands are visited in source order, so the first undefined variable reported is the leftmost one
+        work_.clear();
+        work_.push_back({root, stage::STAGE_START, true});
+
+        while (!work_.empty()) {
+            const work_item item = work_.back();
+            work_.pop_back();
+
+            const ast_node& node = (*program_)[item.ref];
+            if (item.step == stage::STAGE_START) {
+                switch (node.type) {
+                    case ast_node_type::NODE_BINARY_OP:
+                        work_.push_back({item.ref, stage::STAGE_FINISH, true});
+                        work_.push_back({node.right(), stage::STAGE_START, true});
+                        work_.push_back({node.left(), stage::STAGE_START, true});
+                        continue;
+                    case ast_node_type::NODE_ASSIGN_OP:
+                    case ast_node_type::NODE_PRINT_STMT:
+                        work_.push_back({item.ref, stage::STAGE_FINISH, true});
+                        work_.push_back({node.type == ast_node_type::NODE_PRINT_STMT ? node.left() : node.right(),
+                                         stage::STAGE_START, true});
+                        continue;
+                    default:
+                        break;
                 }
-                generate_number(number);
-                break;
             }
-            case ast_node_type::NODE_BINARY_OP: {
-                auto* binop = DCAST<ast_binary_op*>(node);
-                if (!binop) {
-                    throw codegen_error("Could not cast ast_node to ast_binary_op");
+
+            u8 need       = 1;
+            bool integral = false;
+            switch (node.type) {
+                case ast_node_type::NODE_NUMBER:
+                    integral = node.number == std::floor(node.number);
+                    break;
+                case ast_node_type::NODE_IDENTIFIER:
+                    // A standalone statement cannot know what earlier statements assigned; record the read for the
+                    // caller to check
+                    if (fragment_) {
+                        fragment_->loads.push_back(node.symbol);
+                    } else if (!asm_emitter_.has_var(node.symbol)) {
+                        throw codegen_error("Undefined variable: " + string(symbol_table::global().name(node.symbol)));
+                    }
+                    break;
+                case ast_node_type::NODE_BINARY_OP: {
+                    const u8 left  = need_[node.left()];
+                    const u8 right = need_[node.right()];
+                    switch (shape_of(node)) {
+                        case operand_shape::SHAPE_MEMORY_RIGHT:
+                            need = left;
+                            break;
+                        case operand_shape::SHAPE_MEMORY_LEFT:
+                            need = right;
+                            break;
+                        case operand_shape::SHAPE_REGISTERS:
+                            need = left == right ? CAST<u8>(std::min(left + 1, 255)) : std::max(left, right);
+                            break;
+                    }
+                    if (node.op == token_type::TOKEN_MODULO) {
+                        // The operands plus a scratch register for floor(a/b) * b
+                        need = std::max<u8>(need, is_leaf(node.right()) ? 2 : 3);
+                    }
+
+                    // Sums, differences and products of integers are integers unless they overflow to infinity
+                    switch (node.op) {
+                        case token_type::TOKEN_FLOOR_DIV:
+                            integral = true;
+                            break;
+                        case token_type::TOKEN_DIVIDE:
+                            break;
+                        default:
+                            integral = integral_[node.left()] && integral_[node.right()];
+                            break;
+                    }
+                    break;
                 }
-                generate_binary_op(binop);
-                break;
+                case ast_node_type::NODE_ASSIGN_OP:
+                    // Left side must be an identifier
+                    if ((*program_)[node.left()].type != ast_node_type::NODE_IDENTIFIER) {
+                        throw codegen_error("Left side of assignment must be an identifier");
+                    }
+                    need     = need_[node.right()];
+                    integral = integral_[node.right()];
+                    break;
+                case ast_node_type::NODE_PRINT_STMT:
+                    need     = need_[node.left()];
+                    integral = integral_[node.left()];
+                    break;
+                default:
+                    break;
+            }
+            need_[item.ref]     = need;
+            integral_[item.ref] = integral;
+        }
+    }
+
+    bool code_generator::can_pack(span<const ast_ref> statements) {
+        const size_t lanes = statements.size();
+        pack_item root {{}, stage::STAGE_START};
+        for (size_t i = 0; i < lanes; ++i) {
+            const ast_node& statement = (*program_)[statements[i]];
+            if (statement.type != ast_node_type::NODE_ASSIGN_OP) {
+                return false;
             }
-            case ast_node_type::NODE_IDENTIFIER: {
-                auto* ident = DCAST<ast_identifier*>(node);
-                if (!ident) {
-                    throw codegen_error("Could not cast ast_node to ast_identifier");
+            const ast_node& target = (*program_)[statement.left()];
+            if (target.type != ast_node_type::NODE_IDENTIFIER || assigned_earlier(target.symbol, i)) {
+                return false;
+            }
+            pack_targets_[i] = target.symbol;
+            root.lanes[i]    = statement.right();
+        }
+        if ((*program_)[root.lanes[0]].type != ast_node_type::NODE_BINARY_OP) {
+            return false;
+        }
+
+        if (pack_need_.size() < program_->node_count()) {
+            pack_need_.resize(program_->node_count());
+        }
+        // Four lanes load and store their upper pair through one more register
+        const u32 spare = lanes == 4 ? 1 : 0;
+
+        // Walk all values in lockstep, comparing shapes and computing how many registers the packed code needs.
+        // Leaves are always loaded into registers: packed instructions cannot take unaligned memory operands.
+        pack_work_.clear();
+        pack_work_.push_back(root);
+        while (!pack_work_.empty()) {
+            const pack_item item = pack_work_.back();
+            pack_work_.pop_back();
+
+            const ast_node& a = (*program_)[item.lanes[0]];
+            if (a.type == ast_node_type::NODE_BINARY_OP) {
+                for (size_t i = 1; i < lanes; ++i) {
+                    const ast_node& b = (*program_)[item.lanes[i]];
+                    if (b.type != ast_node_type::NODE_BINARY_OP || a.op != b.op) {
+                        return false;
+                    }
                 }
-                generate_identifier(ident);
-                break;
+                // roundpd is SSE4.1; baseline x86-64 rounds down one scalar at a time
+                if ((a.op == token_type::TOKEN_FLOOR_DIV || a.op == token_type::TOKEN_MODULO) &&
+                    !target_info::has_round(options_.arch)) {
+                    return false;
+                }
+                if (item.step == stage::STAGE_START) {
+                    pack_work_.push_back({item.lanes, stage::STAGE_FINISH});
+                    pack_work_.push_back(operands_of(item, lanes, false));
+                    pack_work_.push_back(operands_of(item, lanes, true));
+                    continue;
+                }
+
+                const u8 left  = pack_need_[a.left()];
+                const u8 right = pack_need_[a.right()];
+                u8 need        = left == right ? CAST<u8>(std::min(left + 1, 255)) : std::max(left, right);
+                if (a.op == token_type::TOKEN_MODULO) {
+                    need = std::max<u8>(need, 3);  // Both operands plus the scratch register
+                }
+                if (need + spare > register_count_) {
+                    return false;
+                }
+                pack_need_[item.lanes[0]] = need;
+                continue;
             }
-            case ast_node_type::NODE_ASSIGN_OP: {
-                auto* assign = DCAST<ast_assign_op*>(node);
-                if (!assign) {
-                    throw codegen_error("Could not cast ast_node to ast_assign_op");
+
+            for (size_t i = 0; i < lanes; ++i) {
+                if (!is_leaf(item.lanes[i])) {
+                    return false;
+                }
+                // Every statement is evaluated before the earlier ones' stores
+                const ast_node& b = (*program_)[item.lanes[i]];
+                if (b.type == ast_node_type::NODE_IDENTIFIER && assigned_earlier(b.symbol, i)) {
+                    return false;
                 }
-                generate_assign_op(assign);
-                break;
             }
-            case ast_node_type::NODE_PRINT_STMT: {
-                auto* print = DCAST<ast_print_stmt*>(node);
-                if (!print) {
-                    throw codegen_error("Could not cast ast_node to ast_print_stmt");
+            pack_need_[item.lanes[0]] = 1;
+        }
+
+        return true;
+    }
+
+    void code_generator::generate_pack(span<const ast_ref> statements) {
+        // Report errors exactly as if the statements were compiled one after the other; `can_pack` made sure none
+        // depends on an earlier one
+        for (const ast_ref statement : statements) {
+            label(statement);
+        }
+
+        const auto lanes = CAST<u8>(statements.size());
+        pack_item root {{}, stage::STAGE_START};
+        for (size_t i = 0; i < lanes; ++i) {
+            root.lanes[i] = (*program_)[statements[i]].right();
+        }
+
+        pack_work_.clear();
+        pack_values_.clear();
+        pack_work_.push_back(root);
+        while (!pack_work_.empty()) {
+            const pack_item item = pack_work_.back();
+            pack_work_.pop_back();
+
+            const ast_node& node = (*program_)[item.lanes[0]];
+            if (node.type != ast_node_type::NODE_BINARY_OP) {
+                const u8 reg = allocate();
+                if (lanes == 2) {
+                    asm_emitter_.emit_load_pair(reg, operand_of(item.lanes[0]), operand_of(item.lanes[1]));
+                } else {
+                    const array<asm_operand, 4> leaves = {operand_of(item.lanes[0]), operand_of(item.lanes[1]),
+                                                          operand_of(item.lanes[2]), operand_of(item.lanes[3])};
+                    const u8 temp                      = allocate();
+                    asm_emitter_.emit_load_quad(reg, leaves, temp);
+                    release(temp);
                 }
-                generate_print_stmt(print);
-                break;
+                pack_values_.push_back(reg);
+                continue;
             }
-            default:
-                throw codegen_error("Unknown AST node type");
+
+            const bool right_first = pack_need_[node.right()] > pack_need_[node.left()];
+            switch (item.step) {
+                case stage::STAGE_START:
+                    pack_work_.push_back({item.lanes, stage::STAGE_SECOND});
+                    pack_work_.push_back(operands_of(item, lanes, !right_first));
+                    continue;
+                case stage::STAGE_SECOND:
+                    pack_work_.push_back({item.lanes, stage::STAGE_FINISH});
+                    pack_work_.push_back(operands_of(item, lanes, right_first));
+                    continue;
+                case stage::STAGE_FINISH:
+                    break;
+            }
+
+            const u8 second_value = pack_values_.back();
+            pack_values_.pop_back();
+            const u8 first_value = pack_values_.back();
+            pack_values_.pop_back();
+            const u8 left  = right_first ? second_value : first_value;
+            const u8 right = right_first ? first_value : second_value;
+
+            switch (node.op) {
+                case token_type::TOKEN_ADD:
+                    asm_emitter_.emit_packed_add(left, right, lanes);
+                    break;
+                case token_type::TOKEN_SUBTRACT:
+                    asm_emitter_.emit_packed_sub(left, right, lanes);
+                    break;
+                case token_type::TOKEN_MULTIPLY:
+                    asm_emitter_.emit_packed_mul(left, right, lanes);
+                    break;
+                case token_type::TOKEN_DIVIDE:
+                    asm_emitter_.emit_packed_div(left, right, lanes);
+                    break;
+                case token_type::TOKEN_FLOOR_DIV:
+                    asm_emitter_.emit_packed_floor_div(left, right, lanes);
+                    break;
+                case token_type::TOKEN_MODULO: {
+                    const u8 scratch = allocate();
+                    asm_emitter_.emit_packed_mod(left, right, scratch, lanes);
+                    release(scratch);
+                    break;
+                }
+                default:
+                    throw codegen_error("Unknown binary operator");
+            }
+            release(right);
+            pack_values_.push_back(left);
+        }
+
+        const u8 value = pack_values_.back();
+        pack_values_.pop_back();
+        array<symbol_id, 4> targets {};
+        for (size_t i = 0; i < lanes; ++i) {
+            targets[i] = (*program_)[(*program_)[statements[i]].left()].symbol;
+        }
+        if (lanes == 2) {
+            asm_emitter_.emit_store_pair(targets[0], targets[1], value);
+        } else {
+            const u8 temp = allocate();
+            asm_emitter_.emit_store_quad(targets, value, temp);
+            release(temp);
+        }
+        release(value);
+    }
+
+    bool code_generator::assigned_earlier(symbol_id symbol, size_t lane) const {
+        return std::find(pack_targets_.begin(), pack_targets_.begin() + CAST<ptrdiff_t>(lane), symbol) !=
+               pack_targets_.begin() + CAST<ptrdiff_t>(lane);
+    }
+
+    code_generator::pack_item code_generator::operands_of(const pack_item& item, size_t lanes, bool left) const {
+        pack_item operands {{}, stage::STAGE_START};
+        for (size_t i = 0; i < lanes; ++i) {
+            const ast_node& node = (*program_)[item.lanes[i]];
+            operands.lanes[i]    = left ? node.left() : node.right();
+        }
+        return operands;
+    }
+
+    bool code_generator::is_leaf(ast_ref ref) const {
+        const ast_node_type type = (*program_)[ref].type;
+        return type == ast_node_type::NODE_NUMBER || type == ast_node_type::NODE_IDENTIFIER;
+    }
+
+    code_generator::operand_shape code_generator::shape_of(const ast_node& binop) const {
+        if (is_leaf(binop.right())) {
+            return operand_shape::SHAPE_MEMORY_RIGHT;
+        }
+        if (is_leaf(binop.left()) && is_commutative(binop.op)) {
+            return operand_shape::SHAPE_MEMORY_LEFT;
+        }
+        return operand_shape::SHAPE_REGISTERS;
+    }
+
+    asm_operand code_generator::operand_of(ast_ref leaf) const {
+        const ast_node& node = (*program_)[leaf];
+        if (node.type == ast_node_type::NODE_NUMBER) {
+            return asm_operand::constant(node.number);
+        }
+        return asm_operand::var(node.symbol);
+    }
+
+    u8 code_generator::allocate() {
+        ensure_free(1);
+        const auto reg = CAST<u8>(std::countr_zero(free_regs_));
+        free_regs_ &= ~(1u << reg);
+        return reg;
+    }
+
+    void code_generator::release(u8 reg) {
+        free_regs_ |= 1u << reg;
+    }
+
+    void code_generator::ensure_free(u32 count) {
+        // Spill the oldest live values first: they are consumed last
+        while (CAST<u32>(std::popcount(free_regs_)) < count && spilled_count_ < values_.size()) {
+            // Spilled values are a prefix of `values_`, so a value's position doubles as its stack slot
+            live_value& value = values_[spilled_count_];
+            asm_emitter_.emit_spill(value.reg, CAST<u32>(spilled_count_++));
+            release(value.reg);
+            value.spilled = true;
         }
     }
 
-    void code_generator::generate_number(ast_number* number) {
-        asm_emitter_.emit_push(number->value);
+    u8 code_generator::take_value() {
+        const live_value value = values_.back();
+        values_.pop_back();
+        if (!value.spilled) {
+            return value.reg;
+        }
+
+        // Spilled values are a prefix of `values_`, so this one is in the highest slot in use
+        --spilled_count_;
+        const u8 reg = allocate();
+        asm_emitter_.emit_reload(reg, CAST<u32>(spilled_count_));
+        return reg;
     }
 
-    void code_generator::generate_identifier(ast_identifier* ident) {
-        // Check if variable exists
-        if (!asm_emitter_.has_var(ident->value)) {
-            throw codegen_error("Undefined variable: " + ident->value);
+    void code_generator::finish_value(u8 reg, bool value_used) {
+        if (value_used) {
+            values_.push_back({reg, false});
+        } else {
+            release(reg);
         }
-        asm_emitter_.emit_load_var(ident->value);
     }
 
-    void code_generator::generate_assign_op(ast_assign_op* assign) {
-        // Left side must be an identifier
-        if (assign->left->type != ast_node_type::NODE_IDENTIFIER) {
-            throw codegen_error("Left side of assignment must be an identifier");
+    void code_generator::generate_leaf(const work_item& item) {
+        const u8 reg = allocate();
+        asm_emitter_.emit_load(reg, operand_of(item.ref));
+        finish_value(reg, item.value_used);
+    }
+
+    void code_generator::generate_binary_op(const work_item& item) {
+        const ast_node& binop     = (*program_)[item.ref];
+        const operand_shape shape = shape_of(binop);
+
+        switch (item.step) {
+            case stage::STAGE_START:
+                if (shape == operand_shape::SHAPE_MEMORY_RIGHT) {
+                    work_.push_back({item.ref, stage::STAGE_FINISH, item.value_used});
+                    work_.push_back({binop.left(), stage::STAGE_START, true});
+                } else if (shape == operand_shape::SHAPE_MEMORY_LEFT) {
+                    work_.push_back({item.ref, stage::STAGE_FINISH, item.value_used});
+                    work_.push_back({binop.right(), stage::STAGE_START, true});
+                } else {
+                    // Needier operand first, so the other one can reuse all but one of its registers
+                    const bool right_first = need_[binop.right()] > need_[binop.left()];
+                    work_.push_back({item.ref, stage::STAGE_SECOND, item.value_used});
+                    work_.push_back({right_first ? binop.right() : binop.left(), stage::STAGE_START, true});
+                }
+                return;
+            case stage::STAGE_SECOND: {
+                const bool right_first = need_[binop.right()] > need_[binop.left()];
+                work_.push_back({item.ref, stage::STAGE_FINISH, item.value_used});
+                work_.push_back({right_first ? binop.left() : binop.right(), stage::STAGE_START, true});
+                return;
+            }
+            case stage::STAGE_FINISH:
+                break;
+        }
+
+        // Both operands are evaluated; the result goes in the left operand's register
+        switch (shape) {
+            case operand_shape::SHAPE_MEMORY_RIGHT: {
+                const u8 left              = take_value();
+                const ast_node& right      = (*program_)[binop.right()];
+                const bool literal_divisor = right.type == ast_node_type::NODE_NUMBER;
+                if (!(options_.strength_reduce && literal_divisor &&
+                      reduce_strength(binop.op, left, right.number, integral_[binop.left()]))) {
+                    emit_operator(binop.op, left, operand_of(binop.right()));
+                }
+                finish_value(left, item.value_used);
+                break;
+            }
+            case operand_shape::SHAPE_MEMORY_LEFT: {
+                const u8 right = take_value();
+                emit_operator(binop.op, right, operand_of(binop.left()));
+                finish_value(right, item.value_used);
+                break;
+            }
+            case operand_shape::SHAPE_REGISTERS: {
+                const bool right_first = need_[binop.right()] > need_[binop.left()];
+                const u8 second        = take_value();
+                const u8 first         = take_value();
+                const u8 left          = right_first ? second : first;
+                const u8 right         = right_first ? first : second;
+
+                emit_operator(binop.op, left, asm_operand::xmm(right));
+                release(right);
+                finish_value(left, item.value_used);
+                break;
+            }
         }
+    }
 
-        auto* ident = DCAST<ast_identifier*>(assign->left.get());
-        if (!ident) {
-            throw codegen_error("Could not cast left side to identifier");
+    void code_generator::generate_assign_op(const work_item& item) {
+        const ast_node& assign = (*program_)[item.ref];
+        if (item.step == stage::STAGE_START) {
+            work_.push_back({item.ref, stage::STAGE_FINISH, item.value_used});
+            work_.push_back({assign.right(), stage::STAGE_START, true});
+            return;
         }
 
-        // Generate code for the right-hand side (pushes value onto stack)
-        generate(assign->right.get());
+        const ast_node& target = (*program_)[assign.left()];
+        if (fragment_) {
+            fragment_->stores.push_back(target.symbol);
+        }
 
-        // Store the value into the variable
-        asm_emitter_.emit_store_var(ident->value);
+        // The value stays in its register when the assignment is itself an operand (e.g. the inner `y = 3` of
+        // `x = y = 3`)
+        const u8 value = take_value();
+        asm_emitter_.emit_store_var(target.symbol, value);
+        finish_value(value, item.value_used);
     }
 
-    void code_generator::generate_print_stmt(ast_print_stmt* print) {
-        // Generate code for the expression (pushes value onto stack)
-        generate(print->expr.get());
+    void code_generator::generate_print_stmt(const work_item& item) {
+        if (item.step == stage::STAGE_START) {
+            work_.push_back({item.ref, stage::STAGE_FINISH, item.value_used});
+            work_.push_back({(*program_)[item.ref].left(), stage::STAGE_START, true});
+            return;
+        }
+
+        // The call clobbers every xmm register, so nothing else may be live in one
+        const u8 value = take_value();
+        ensure_free(register_count_ - 1);
 
-        // Emit print instruction
-        asm_emitter_.emit_print();
+        // Every other live value is spilled by now, so the first free slot is past all of them
+        const auto slot = CAST<u32>(spilled_count_);
+        if (item.value_used) {
+            asm_emitter_.emit_spill(value, slot);
+        }
+        asm_emitter_.emit_print(value);
+        if (item.value_used) {
+            asm_emitter_.emit_reload(value, slot);
+        }
+        finish_value(value, item.value_used);
     }
 
-    void code_generator::generate_binary_op(ast_binary_op* binop) {
-        // Post-order: left, right, then operator
-        generate(binop->left.get());
-        generate(binop->right.get());
+    bool code_generator::reduce_strength(token_type op, u8 dst, f64 divisor, bool integral) {
+        const optional<f64> reciprocal = exact_reciprocal(divisor);
+        if (!reciprocal || (op != token_type::TOKEN_DIVIDE && op != token_type::TOKEN_FLOOR_DIV &&
+                            op != token_type::TOKEN_MODULO)) {
+            return false;
+        }
+
+        std::ostringstream replacement;
+        replacement.precision(17);
+        const bool by_one = divisor == 1.0;
+        switch (op) {
+            case token_type::TOKEN_DIVIDE:
+                if (by_one) {
+                    replacement << "x";
+                } else {
+                    asm_emitter_.emit_mul(dst, asm_operand::constant(*reciprocal));
+                    replacement << "x * " << *reciprocal;
+                }
+                break;
+            case token_type::TOKEN_FLOOR_DIV:
+                // floor(x) is x itself for integers, infinities and NaN
+                if (by_one && integral) {
+                    replacement << "x";
+                } else if (by_one) {
+                    asm_emitter_.emit_floor(dst);
+                    replacement << "floor(x)";
+                } else {
+                    asm_emitter_.emit_mul(dst, asm_operand::constant(*reciprocal));
+                    asm_emitter_.emit_floor(dst);
+                    replacement << "floor(x * " << *reciprocal << ")";
+                }
+                break;
+            default:
+                if (by_one && integral) {
+                    // x - floor(x) is x - x, including the NaN it gives for infinities
+                    asm_emitter_.emit_sub(dst, asm_operand::xmm(dst));
+                    replacement << "x - x";
+                } else {
+                    const u8 scratch = allocate();
+                    asm_emitter_.emit_mod_by_power_of_two(dst, divisor, scratch);
+                    release(scratch);
+                    if (by_one) {
+                        replacement << "x - floor(x)";
+                    } else {
+                        replacement << "x - floor(x * " << *reciprocal << ") * " << divisor;
+                    }
+                }
+                break;
+        }
+
+        rewrites_.push_back({statement_index_, op, divisor, replacement.str()});
+        return true;
+    }
 
-        // Emit instructions
-        switch (binop->op) {
+    void code_generator::emit_operator(token_type op, u8 dst, const asm_operand& src) {
+        switch (op) {
             case token_type::TOKEN_ADD:
-                asm_emitter_.emit_add();
+                asm_emitter_.emit_add(dst, src);
                 break;
             case token_type::TOKEN_SUBTRACT:
-                asm_emitter_.emit_sub();
+                asm_emitter_.emit_sub(dst, src);
                 break;
             case token_type::TOKEN_MULTIPLY:
-                asm_emitter_.emit_mul();
+                asm_emitter_.emit_mul(dst, src);
                 break;
             case token_type::TOKEN_DIVIDE:
-                asm_emitter_.emit_div();
+                asm_emitter_.emit_div(dst, src);
                 break;
-            case token_type::TOKEN_MODULO:
-                asm_emitter_.emit_mod();
+            case token_type::TOKEN_MODULO: {
+                const u8 scratch = allocate();
+                asm_emitter_.emit_mod(dst, src, scratch);
+                release(scratch);
                 break;
+            }
             case token_type::TOKEN_FLOOR_DIV:
-                asm_emitter_.emit_floor_div();
+                asm_emitter_.emit_floor_div(dst, src);
                 break;
             default:
                 throw codegen_error("Unknown binary operator");
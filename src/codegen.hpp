@@ -2,6 +2,7 @@
 
 #include "asm_emitter.hpp"
 #include "ast.hpp"
+#include "options.hpp"
 #include <stdexcept>
 
 namespace mathc {
@@ -10,28 +11,148 @@ namespace mathc {
         using std::runtime_error::runtime_error;
     };
 
+    /// @brief Assembly for a single statement compiled on its own, plus what is needed to splice it into a program
+    struct statement_code {
+        asm_code code;
+        vector<symbol_id> loads;   // variables read; must be assigned by an earlier statement
+        vector<symbol_id> stores;  // variables assigned
+        vector<f64> literals;      // constants referenced from .rodata
+        u32 stack_slots;           // spill slots the statement needs in the frame
+        bool prints;
+    };
+
+    /// @brief A division, floor division or modulo by a constant that was compiled without its `divsd`
+    struct strength_rewrite {
+        u32 statement;  // index of the statement in the program
+        token_type op;
+        f64 divisor;
+        string replacement;  // what `x <op> divisor` was compiled as
+    };
+
+    /// @brief Translates statements into register-allocated x86-64 code.
+    ///
+    /// Expression temporaries live in xmm0-xmm15. Each statement is first labelled with Sethi-Ullman numbers (the
+    /// registers needed to evaluate a subtree without spilling); operands are then evaluated needier-first, so a tree
+    /// needs at most one register more than its largest subtree. Variables and constants are used directly as memory
+    /// operands (`addsd xmm0, [rbx + 24]`) where they appear as the right operand, or as either operand of `+` and `*`.
+    /// Only when a subtree needs more registers than are free are the oldest live temporaries spilled, each to a fixed
+    /// slot of a frame the prologue reserves once, so rsp never moves inside the program.
+    ///
+    /// With vectorization on, two adjacent assignments whose values are trees of the same shape, with the same
+    /// operators, are evaluated together: each pair of leaves is loaded into the two lanes of one register and each
+    /// pair of operators becomes one packed SSE2 instruction (`addpd`, `mulpd`, ...). With AVX, four such assignments
+    /// are tried first and use the four lanes of ymm registers (`vaddpd ymm0, ymm0, ymm1`, ...). Lanes are computed
+    /// with exactly the scalar operations, so results do not change. No statement may read an earlier one's target,
+    /// and the pack must fit in registers.
+    ///
+    /// With strength reduction on, a division, `//` or `%` by a literal power of two uses a multiplication by its
+    /// reciprocal, which rounds the same exact quotient and so gives the same bits. Dividing by 1 needs no division at
+    /// all, and `x // 1` and `x % 1` need no rounding either when `x` is known to be an integer, infinity or NaN.
     class code_generator {
     public:
-        code_generator() = default;
+        explicit code_generator(const compile_options& options = {})
+            : options_(options),
+              asm_emitter_(options.arch),
+              register_count_(asm_emitter::usable_registers(options.arch)),
+              free_regs_((1u << register_count_) - 1) {}
+
+        /// Compiles one statement without regard to the rest of the program. The result only depends on the
+        /// statement's AST, so it can be cached and reused across compilations.
+        statement_code generate_statement(const mathc_program& program, ast_ref ref);
 
-        void generate(ast_node* node);
+        void generate(ast_ref ref);
         void generate_program(const mathc_program& program);
 
-        string get_asm() const {
-            return asm_emitter_.get_code();
+        /// Every strength reduction applied so far, in program order
+        [[nodiscard]] span<const strength_rewrite> get_rewrites() const {
+            return rewrites_;
+        }
+
+        /// The compiled program (see `asm_emitter::take_output`)
+        program_output take_output() {
+            return asm_emitter_.take_output(options_.emit, options_.freestanding, options_.format);
         }
 
         [[nodiscard]] const asm_emitter& get_emitter() const {
             return asm_emitter_;
         }
 
+        [[nodiscard]] asm_emitter& get_emitter() {
+            return asm_emitter_;
+        }
+
     private:
+        enum class stage : u8 {
+            STAGE_START,   // nothing evaluated yet
+            STAGE_SECOND,  // the needier operand is in a register; evaluate the other one
+            STAGE_FINISH,  // operands are evaluated; emit the node itself
+        };
+
+        /// How the operands of a binary operator are evaluated
+        enum class operand_shape : u8 {
+            SHAPE_MEMORY_RIGHT,  // left in a register, right is a memory operand
+            SHAPE_MEMORY_LEFT,   // right in a register, left is a memory operand (commutative operators only)
+            SHAPE_REGISTERS,     // both in registers
+        };
+
+        struct work_item {
+            ast_ref ref;
+            stage step;
+            bool value_used;  // false only for the statement itself
+        };
+
+        /// A node of the first statement of a pack and the nodes in the same position of the others
+        struct pack_item {
+            array<ast_ref, 4> lanes;
+            stage step;
+        };
+
+        /// An evaluated operand waiting for the node that consumes it
+        struct live_value {
+            u8 reg;
+            bool spilled;  // moved to the stack to free its register
+        };
+
+        compile_options options_;
         asm_emitter asm_emitter_;
+        const mathc_program* program_ = nullptr;
+        statement_code* fragment_     = nullptr;  // set while compiling a standalone statement
+        vector<work_item> work_;                  // explicit traversal stack, reused across statements
+        vector<u8> need_;                         // node -> Sethi-Ullman number
+        vector<bool> integral_;                   // node -> value is always an integer, an infinity or NaN
+        vector<live_value> values_;               // evaluated operands, oldest first; the spilled ones are a prefix
+        size_t spilled_count_ = 0;
+        u8 register_count_;                       // xmm registers available for temporaries
+        u32 free_regs_;                           // bit i set if xmm<i> is free
+        vector<pack_item> pack_work_;
+        vector<u8> pack_need_;              // node of a pack's first statement -> registers to evaluate it packed
+        vector<u8> pack_values_;            // registers holding evaluated operand packs
+        array<symbol_id, 4> pack_targets_;  // variables the statements of a pack assign
+        vector<strength_rewrite> rewrites_;
+        u32 statement_index_ = 0;
+
+        void label(ast_ref root);
+        [[nodiscard]] bool can_pack(span<const ast_ref> statements);
+        void generate_pack(span<const ast_ref> statements);
+        /// Whether a statement before `lane` in the pack being checked assigns `symbol`
+        [[nodiscard]] bool assigned_earlier(symbol_id symbol, size_t lane) const;
+        /// The left or right operands of the binary operators in `item`
+        [[nodiscard]] pack_item operands_of(const pack_item& item, size_t lanes, bool left) const;
+        [[nodiscard]] bool is_leaf(ast_ref ref) const;
+        [[nodiscard]] operand_shape shape_of(const ast_node& binop) const;
+        [[nodiscard]] asm_operand operand_of(ast_ref leaf) const;
+
+        u8 allocate();
+        void release(u8 reg);
+        void ensure_free(u32 count);
+        u8 take_value();
+        void finish_value(u8 reg, bool value_used);
 
-        void generate_number(ast_number* number);
-        void generate_binary_op(ast_binary_op* binop);
-        void generate_assign_op(ast_assign_op* assop);
-        void generate_identifier(ast_identifier* ident);
-        void generate_print_stmt(ast_print_stmt* stmt);
+        void generate_leaf(const work_item& item);
+        void generate_binary_op(const work_item& item);
+        void generate_assign_op(const work_item& item);
+        void generate_print_stmt(const work_item& item);
+        void emit_operator(token_type op, u8 dst, const asm_operand& src);
+        [[nodiscard]] bool reduce_strength(token_type op, u8 dst, f64 divisor, bool integral);
     };
 }  // namespace mathc
@@ -0,0 +1,145 @@
+#include "elf_executable.hpp"
+#include "byte_writer.hpp"
+
+namespace mathc {
+    namespace {
+        constexpr u32 PT_LOAD      = 1;
+        constexpr u32 PT_GNU_STACK = 0x6474E551;
+
+        constexpr u32 PF_X = 0x1;
+        constexpr u32 PF_W = 0x2;
+        constexpr u32 PF_R = 0x4;
+
+        constexpr u64 HEADER_SIZE         = 64;
+        constexpr u64 PROGRAM_HEADER_SIZE = 56;
+
+        u64 align_up(u64 value, u64 alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    }  // namespace
+
+    void elf_executable::set_text(vector<u8> code) {
+        text_ = std::move(code);
+    }
+
+    u64 elf_executable::add_rodata(span<const u8> data, u64 alignment) {
+        while (rodata_.size() % alignment != 0) {
+            rodata_.push_back(0);
+        }
+
+        const u64 offset = rodata_.size();
+        rodata_.insert(rodata_.end(), data.begin(), data.end());
+        return offset;
+    }
+
+    void elf_executable::set_bss(u64 size) {
+        bss_size_ = size;
+    }
+
+    void elf_executable::set_entry(u64 offset) {
+        entry_ = offset;
+    }
+
+    void elf_executable::add_relocation(u64 offset, section where, u64 target, i64 addend) {
+        relocations_.push_back({offset, where, target, addend});
+    }
+
+    // Code, headers included: one read-only, executable segment. Constants: a read-only one from the next page on,
+    // in the file as well, so no page of them is mapped executable. Variables: a writable one from the page after
+    // that.
+    u16 elf_executable::segment_count() const {
+        return CAST<u16>(2 + (rodata_.empty() ? 0 : 1) + (bss_size_ != 0 ? 1 : 0));  // Plus PT_GNU_STACK
+    }
+
+    u64 elf_executable::text_offset() const {
+        return align_up(HEADER_SIZE + segment_count() * PROGRAM_HEADER_SIZE, 16);
+    }
+
+    u64 elf_executable::rodata_offset() const {
+        return align_up(text_offset() + text_.size(), page_size);
+    }
+
+    u64 elf_executable::image_size() const {
+        return rodata_.empty() ? text_offset() + text_.size() : rodata_offset() + rodata_.size();
+    }
+
+    u64 elf_executable::address(section where, u64 offset) const {
+        switch (where) {
+            case section::SECTION_TEXT:
+                return base_address + text_offset() + offset;
+            case section::SECTION_RODATA:
+                return base_address + rodata_offset() + offset;
+            case section::SECTION_BSS:
+                return align_up(base_address + image_size(), page_size) + offset;
+            case section::SECTION_UNDEFINED:
+                break;
+        }
+        throw std::logic_error("undefined symbols cannot be resolved in an executable");
+    }
+
+    vector<u8> elf_executable::serialize() const {
+        vector<u8> out;
+        byte_writer writer(out);
+        out.reserve(image_size());
+
+        // ELF header
+        static constexpr u8 ident[] = {0x7F, 'E', 'L', 'F', 2 /* 64-bit */, 1 /* little endian */, 1 /* version */};
+        out.assign(std::begin(ident), std::end(ident));
+        out.resize(16);                // OS ABI and padding
+        writer.put<u16>(2);            // Executable
+        writer.put<u16>(62);           // x86-64
+        writer.put<u32>(1);            // Version
+        writer.put<u64>(address(section::SECTION_TEXT, entry_));
+        writer.put<u64>(HEADER_SIZE);  // Program header table
+        writer.put<u64>(0);            // No section header table
+        writer.put<u32>(0);            // Flags
+        writer.put<u16>(HEADER_SIZE);
+        writer.put<u16>(PROGRAM_HEADER_SIZE);
+        writer.put<u16>(segment_count());
+        writer.put<u16>(0);            // Section header entry size, count and string table index
+        writer.put<u16>(0);
+        writer.put<u16>(0);
+
+        // Program headers
+        const auto put_segment = [&writer](u32 type, u32 flags, u64 offset, u64 address, u64 file_size,
+                                           u64 memory_size, u64 alignment) {
+            writer.put<u32>(type);
+            writer.put<u32>(flags);
+            writer.put<u64>(offset);
+            writer.put<u64>(address);
+            writer.put<u64>(address);  // Physical address
+            writer.put<u64>(file_size);
+            writer.put<u64>(memory_size);
+            writer.put<u64>(alignment);
+        };
+        const u64 text_end = text_offset() + text_.size();
+        put_segment(PT_LOAD, PF_R | PF_X, 0, base_address, text_end, text_end, page_size);
+        if (!rodata_.empty()) {
+            put_segment(PT_LOAD, PF_R, rodata_offset(), address(section::SECTION_RODATA, 0), rodata_.size(),
+                        rodata_.size(), page_size);
+        }
+        if (bss_size_ != 0) {
+            // Nothing of it is in the file; the offset only has to match the address modulo the page size
+            put_segment(PT_LOAD, PF_R | PF_W, 0, address(section::SECTION_BSS, 0), 0, bss_size_, page_size);
+        }
+        put_segment(PT_GNU_STACK, PF_R | PF_W, 0, 0, 0, 0, 16);  // Non-executable stack
+
+        // .text with its references filled in, then .rodata
+        writer.pad_to(16);
+        const u64 text_start = out.size();
+        out.insert(out.end(), text_.begin(), text_.end());
+        for (const relocation& r : relocations_) {
+            const i64 distance =
+                CAST<i64>(address(r.where, r.target)) + r.addend - CAST<i64>(address(section::SECTION_TEXT, r.offset));
+            for (u32 i = 0; i < 4; ++i) {
+                out[text_start + r.offset + i] = CAST<u8>(CAST<u64>(distance) >> (8 * i));
+            }
+        }
+        if (!rodata_.empty()) {
+            writer.pad_to(page_size);
+            out.insert(out.end(), rodata_.begin(), rodata_.end());
+        }
+
+        return out;
+    }
+}  // namespace mathc
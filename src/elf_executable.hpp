@@ -0,0 +1,60 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include "elf_object.hpp"
+
+namespace mathc {
+    /// @brief A static, non-position-independent ELF64 executable for x86-64, built in memory.
+    ///
+    /// It is what the linker would make of the program's `elf_object` and the print runtime: the ELF and program
+    /// headers and .text share one read-only, executable segment at `base_address`, .rodata gets a read-only segment
+    /// starting on the next page, and .bss a writable one on the page after. There are no section headers. References
+    /// from .text are resolved when the file is written, since only then is the layout fixed.
+    class elf_executable {
+    public:
+        using section = elf_object::section;
+
+        static constexpr u64 base_address = 0x400000;
+        static constexpr u64 page_size    = 0x1000;
+
+        void set_text(vector<u8> code);
+
+        /// Appends `data` to .rodata at a multiple of `alignment` (up to the page size), returning its offset
+        u64 add_rodata(span<const u8> data, u64 alignment);
+
+        /// .bss starts on a page boundary, so it is aligned for anything
+        void set_bss(u64 size);
+
+        /// Starts the program at `offset` in .text
+        void set_entry(u64 offset);
+
+        /// Fills in the 32-bit field at `offset` in .text with the distance from it to `target` in `where`, plus
+        /// `addend` (S + A - P, like R_X86_64_PC32)
+        void add_relocation(u64 offset, section where, u64 target, i64 addend);
+
+        /// The executable file's bytes
+        [[nodiscard]] vector<u8> serialize() const;
+
+    private:
+        struct relocation {
+            u64 offset;
+            section where;
+            u64 target;
+            i64 addend;
+        };
+
+        vector<u8> text_;
+        vector<u8> rodata_;
+        u64 bss_size_ = 0;
+        u64 entry_    = 0;
+        vector<relocation> relocations_;
+
+        /// Virtual address of `offset` in `where`
+        [[nodiscard]] u64 address(section where, u64 offset) const;
+        [[nodiscard]] u16 segment_count() const;
+        [[nodiscard]] u64 text_offset() const;
+        [[nodiscard]] u64 rodata_offset() const;
+        /// Bytes of the file, which are all loaded
+        [[nodiscard]] u64 image_size() const;
+    };
+}  // namespace mathc
@@ -0,0 +1,193 @@
+#include "elf_object.hpp"
+#include "byte_writer.hpp"
+
+namespace mathc {
+    namespace {
+        // Section header indices, in file order. The first three match `elf_object::section`.
+        enum section_index : u16 {
+            SHN_TEXT = 1,
+            SHN_RODATA,
+            SHN_BSS,
+            SHN_NOTE_STACK,
+            SHN_SYMTAB,
+            SHN_STRTAB,
+            SHN_RELA_TEXT,
+            SHN_SHSTRTAB,
+            SECTION_COUNT,
+        };
+
+        constexpr u32 SHT_PROGBITS = 1;
+        constexpr u32 SHT_SYMTAB   = 2;
+        constexpr u32 SHT_STRTAB   = 3;
+        constexpr u32 SHT_RELA     = 4;
+        constexpr u32 SHT_NOBITS   = 8;
+
+        constexpr u64 SHF_WRITE     = 0x1;
+        constexpr u64 SHF_ALLOC     = 0x2;
+        constexpr u64 SHF_EXECINSTR = 0x4;
+        constexpr u64 SHF_INFO_LINK = 0x40;
+
+        constexpr u8 STB_LOCAL    = 0;
+        constexpr u8 STB_GLOBAL   = 1;
+        constexpr u8 STT_NOTYPE   = 0;
+        constexpr u8 STT_SECTION  = 3;
+        constexpr u64 SYMBOL_SIZE = 24;
+        constexpr u64 RELA_SIZE   = 24;
+        constexpr u64 HEADER_SIZE = 64;
+
+        struct section_header {
+            u32 name;  // offset in .shstrtab
+            u32 type;
+            u64 flags;
+            u64 offset;
+            u64 size;
+            u32 link;
+            u32 info;
+            u64 alignment;
+            u64 entry_size;
+        };
+
+        /// Appends `name` with its terminator to a string table, returning its offset
+        u32 add_string(string& table, std::string_view name) {
+            const auto offset = CAST<u32>(table.size());
+            table += name;
+            table += '\0';
+            return offset;
+        }
+    }  // namespace
+
+    void elf_object::set_text(vector<u8> code) {
+        text_ = std::move(code);
+    }
+
+    u64 elf_object::add_rodata(span<const u8> data, u64 alignment) {
+        while (rodata_.size() % alignment != 0) {
+            rodata_.push_back(0);
+        }
+        rodata_alignment_ = std::max(rodata_alignment_, alignment);
+
+        const u64 offset = rodata_.size();
+        rodata_.insert(rodata_.end(), data.begin(), data.end());
+        return offset;
+    }
+
+    void elf_object::set_bss(u64 size, u64 alignment) {
+        bss_size_      = size;
+        bss_alignment_ = alignment;
+    }
+
+    u32 elf_object::add_global(string name, section where, u64 value) {
+        globals_.push_back({std::move(name), where, value});
+        return CAST<u32>(SHN_NOTE_STACK + globals_.size() - 1);  // After the null and section symbols
+    }
+
+    void elf_object::add_relocation(u64 offset, u32 symbol, relocation_type type, i64 addend) {
+        relocations_.push_back({offset, symbol, type, addend});
+    }
+
+    vector<u8> elf_object::serialize() const {
+        string shstrtab(1, '\0');
+        array<section_header, SECTION_COUNT> headers {};
+        headers[SHN_TEXT]       = {add_string(shstrtab, ".text"),           SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+                                   0, text_.size(), 0, 0, 16, 0};
+        headers[SHN_RODATA]     = {add_string(shstrtab, ".rodata"),         SHT_PROGBITS, SHF_ALLOC,
+                                   0, rodata_.size(), 0, 0, rodata_alignment_, 0};
+        headers[SHN_BSS]        = {add_string(shstrtab, ".bss"),            SHT_NOBITS,   SHF_ALLOC | SHF_WRITE,
+                                   0, bss_size_, 0, 0, bss_alignment_, 0};
+        headers[SHN_NOTE_STACK] = {add_string(shstrtab, ".note.GNU-stack"), SHT_PROGBITS, 0,
+                                   0, 0, 0, 0, 1, 0};
+
+        // Symbols: null, one per allocated section, then the globals
+        vector<u8> symtab;
+        string strtab(1, '\0');
+        byte_writer symbols(symtab);
+        const auto put_symbol = [&symbols](u32 name, u8 binding, u8 type, u16 section, u64 value) {
+            symbols.put<u32>(name);
+            symbols.put<u8>(CAST<u8>(binding << 4 | type));
+            symbols.put<u8>(0);  // Default visibility
+            symbols.put<u16>(section);
+            symbols.put<u64>(value);
+            symbols.put<u64>(0);  // Size
+        };
+        put_symbol(0, STB_LOCAL, STT_NOTYPE, 0, 0);
+        for (const u16 section : {SHN_TEXT, SHN_RODATA, SHN_BSS}) {
+            put_symbol(0, STB_LOCAL, STT_SECTION, section, 0);
+        }
+        for (const symbol& global : globals_) {
+            put_symbol(add_string(strtab, global.name), STB_GLOBAL, STT_NOTYPE, CAST<u16>(global.where), global.value);
+        }
+        headers[SHN_SYMTAB] = {add_string(shstrtab, ".symtab"), SHT_SYMTAB, 0, 0, symtab.size(), SHN_STRTAB,
+                               SHN_NOTE_STACK, 8, SYMBOL_SIZE};  // info: index of the first global
+        headers[SHN_STRTAB] = {add_string(shstrtab, ".strtab"), SHT_STRTAB, 0, 0, strtab.size(), 0, 0, 1, 0};
+
+        vector<u8> rela;
+        byte_writer relocations(rela);
+        for (const relocation& r : relocations_) {
+            relocations.put<u64>(r.offset);
+            relocations.put<u64>(CAST<u64>(r.symbol) << 32 | CAST<u32>(r.type));
+            relocations.put<i64>(r.addend);
+        }
+        headers[SHN_RELA_TEXT] = {add_string(shstrtab, ".rela.text"), SHT_RELA, SHF_INFO_LINK, 0, rela.size(),
+                                  SHN_SYMTAB, SHN_TEXT, 8, RELA_SIZE};
+        const u32 shstrtab_name = add_string(shstrtab, ".shstrtab");
+        headers[SHN_SHSTRTAB]   = {shstrtab_name, SHT_STRTAB, 0, 0, shstrtab.size(), 0, 0, 1, 0};
+
+        // Section contents follow the ELF header, each at its alignment, then the section header table
+        vector<u8> out(HEADER_SIZE);
+        byte_writer writer(out);
+        const auto place = [&out, &writer, &headers](section_index index, span<const u8> bytes) {
+            writer.pad_to(headers[index].alignment);
+            headers[index].offset = out.size();
+            out.insert(out.end(), bytes.begin(), bytes.end());
+        };
+        const auto as_bytes = [](const string& text) {
+            return span<const u8>(RCAST<const u8*>(text.data()), text.size());
+        };
+        place(SHN_TEXT, text_);
+        place(SHN_RODATA, rodata_);
+        headers[SHN_BSS].offset        = out.size();
+        headers[SHN_NOTE_STACK].offset = out.size();
+        place(SHN_SYMTAB, symtab);
+        place(SHN_STRTAB, as_bytes(strtab));
+        place(SHN_RELA_TEXT, rela);
+        place(SHN_SHSTRTAB, as_bytes(shstrtab));
+
+        writer.pad_to(8);
+        const u64 section_table = out.size();
+        for (const section_header& header : headers) {
+            writer.put<u32>(header.name);
+            writer.put<u32>(header.type);
+            writer.put<u64>(header.flags);
+            writer.put<u64>(0);  // Address
+            writer.put<u64>(header.offset);
+            writer.put<u64>(header.size);
+            writer.put<u32>(header.link);
+            writer.put<u32>(header.info);
+            writer.put<u64>(header.alignment);
+            writer.put<u64>(header.entry_size);
+        }
+
+        // ELF header
+        vector<u8> header;
+        byte_writer elf(header);
+        static constexpr u8 ident[] = {0x7F, 'E', 'L', 'F', 2 /* 64-bit */, 1 /* little endian */, 1 /* version */};
+        header.assign(std::begin(ident), std::end(ident));
+        header.resize(16);          // OS ABI and padding
+        elf.put<u16>(1);            // Relocatable
+        elf.put<u16>(62);           // x86-64
+        elf.put<u32>(1);            // Version
+        elf.put<u64>(0);            // Entry point
+        elf.put<u64>(0);            // Program header table
+        elf.put<u64>(section_table);
+        elf.put<u32>(0);            // Flags
+        elf.put<u16>(HEADER_SIZE);
+        elf.put<u16>(0);            // Program header entry size and count
+        elf.put<u16>(0);
+        elf.put<u16>(64);           // Section header entry size
+        elf.put<u16>(SECTION_COUNT);
+        elf.put<u16>(SHN_SHSTRTAB);
+        std::copy(header.begin(), header.end(), out.begin());
+
+        return out;
+    }
+}  // namespace mathc
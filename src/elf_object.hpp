@@ -0,0 +1,69 @@
+#pragma once
+
+#include "mathc_common.hpp"
+
+namespace mathc {
+    /// @brief A relocatable ELF64 object file for x86-64, built in memory.
+    ///
+    /// It has the sections a mathc program needs: code in .text, constants in .rodata and zero-initialized data in
+    /// .bss, plus an empty .note.GNU-stack so the linker keeps the stack non-executable. Relocations only ever patch
+    /// .text. The symbol table holds one symbol per section, which relocations use to address into .rodata and .bss,
+    /// followed by the global symbols.
+    class elf_object {
+    public:
+        enum class section : u8 {
+            SECTION_UNDEFINED,  // symbols defined by another object
+            SECTION_TEXT,
+            SECTION_RODATA,
+            SECTION_BSS,
+        };
+
+        enum class relocation_type : u32 {
+            RELOC_PC32  = 2,  // S + A - P
+            RELOC_PLT32 = 4,  // L + A - P, for calls
+        };
+
+        void set_text(vector<u8> code);
+
+        /// Appends `data` to .rodata at a multiple of `alignment`, returning its offset
+        u64 add_rodata(span<const u8> data, u64 alignment);
+
+        void set_bss(u64 size, u64 alignment);
+
+        /// Adds a global symbol at `value` in `where` (undefined ones have no value), returning its index
+        u32 add_global(string name, section where, u64 value);
+
+        /// Index of the symbol for the start of `where`
+        static u32 section_symbol(section where) {
+            return CAST<u32>(where);
+        }
+
+        /// Patches the 32-bit field at `offset` in .text when linking
+        void add_relocation(u64 offset, u32 symbol, relocation_type type, i64 addend);
+
+        /// The object file's bytes
+        [[nodiscard]] vector<u8> serialize() const;
+
+    private:
+        struct symbol {
+            string name;
+            section where;
+            u64 value;
+        };
+
+        struct relocation {
+            u64 offset;
+            u32 symbol;
+            relocation_type type;
+            i64 addend;
+        };
+
+        vector<u8> text_;
+        vector<u8> rodata_;
+        u64 rodata_alignment_ = 1;
+        u64 bss_size_         = 0;
+        u64 bss_alignment_    = 1;
+        vector<symbol> globals_;
+        vector<relocation> relocations_;
+    };
+}  // namespace mathc
@@ -0,0 +1,173 @@
+#include "elf_reader.hpp"
+
+#include <cstring>
+
+namespace mathc {
+    namespace {
+        constexpr u16 ET_REL    = 1;
+        constexpr u16 EM_X86_64 = 62;
+
+        constexpr u32 SHT_SYMTAB = 2;
+        constexpr u32 SHT_RELA   = 4;
+        constexpr u64 SHF_ALLOC  = 0x2;
+
+        constexpr u32 R_X86_64_PC32  = 2;
+        constexpr u32 R_X86_64_PLT32 = 4;
+        constexpr u8 STB_GLOBAL      = 1;
+
+        constexpr u64 SECTION_HEADER_SIZE = 64;
+        constexpr u64 SYMBOL_SIZE         = 24;
+        constexpr u64 RELA_SIZE           = 24;
+
+        struct section_header {
+            u32 name;  // offset in the section name table
+            u32 type;
+            u64 flags;
+            u64 offset;
+            u64 size;
+            u32 link;
+            u32 info;
+            u64 alignment;
+        };
+
+        /// Little-endian `T` at `offset`, like the target (and the host, which runs the output) stores it
+        template <typename T>
+        T load(span<const u8> bytes, u64 offset) {
+            if (offset > bytes.size() || bytes.size() - offset < sizeof(T)) {
+                throw elf_error("truncated object file");
+            }
+            T value;
+            std::memcpy(&value, bytes.data() + offset, sizeof(T));
+            return value;
+        }
+
+        span<const u8> contents(span<const u8> bytes, const section_header& header) {
+            if (header.offset > bytes.size() || bytes.size() - header.offset < header.size) {
+                throw elf_error("truncated object file");
+            }
+            return bytes.subspan(header.offset, header.size);
+        }
+
+        std::string_view name_at(span<const u8> table, u32 offset) {
+            if (offset >= table.size()) {
+                throw elf_error("bad string table offset in object file");
+            }
+            const auto* const start = RCAST<const char*>(table.data() + offset);
+            return {start, strnlen(start, table.size() - offset)};
+        }
+    }  // namespace
+
+    elf_reader elf_reader::read(span<const u8> bytes) {
+        static constexpr u8 ident[] = {0x7F, 'E', 'L', 'F', 2 /* 64-bit */, 1 /* little endian */};
+        if (bytes.size() < 64 || !std::equal(std::begin(ident), std::end(ident), bytes.begin()) ||
+            load<u16>(bytes, 16) != ET_REL || load<u16>(bytes, 18) != EM_X86_64) {
+            throw elf_error("not a relocatable x86-64 ELF object");
+        }
+
+        const auto table_offset = load<u64>(bytes, 40);
+        const auto count        = load<u16>(bytes, 60);
+        const auto names_index  = load<u16>(bytes, 62);
+        vector<section_header> headers(count);
+        for (u16 i = 0; i < count; ++i) {
+            const u64 at = table_offset + i * SECTION_HEADER_SIZE;
+            headers[i]   = {load<u32>(bytes, at),      load<u32>(bytes, at + 4),  load<u64>(bytes, at + 8),
+                            load<u64>(bytes, at + 24), load<u64>(bytes, at + 32), load<u32>(bytes, at + 40),
+                            load<u32>(bytes, at + 44), load<u64>(bytes, at + 48)};
+        }
+        if (names_index >= count) {
+            throw elf_error("object file has no section names");
+        }
+        const span<const u8> names = contents(bytes, headers[names_index]);
+
+        // The sections that are loaded, by index
+        elf_reader object;
+        vector<section> sections(count, section::SECTION_UNDEFINED);
+        for (u16 i = 0; i < count; ++i) {
+            const section_header& header = headers[i];
+            if ((header.flags & SHF_ALLOC) == 0 || header.size == 0) {
+                continue;
+            }
+
+            const std::string_view name = name_at(names, header.name);
+            const u64 alignment         = std::max<u64>(header.alignment, 1);
+            if (name == ".text") {
+                sections[i] = section::SECTION_TEXT;
+                const span<const u8> text = contents(bytes, header);
+                object.text_.assign(text.begin(), text.end());
+            } else if (name == ".rodata") {
+                sections[i] = section::SECTION_RODATA;
+                const span<const u8> rodata = contents(bytes, header);
+                object.rodata_.assign(rodata.begin(), rodata.end());
+                object.rodata_alignment_ = alignment;
+            } else if (name == ".bss") {
+                sections[i]           = section::SECTION_BSS;
+                object.bss_size_      = header.size;
+                object.bss_alignment_ = alignment;
+            } else {
+                throw elf_error("unexpected section in object file: " + string(name));
+            }
+        }
+
+        // Where each symbol is
+        vector<std::pair<section, u64>> symbols;
+        for (const section_header& header : headers) {
+            if (header.type != SHT_SYMTAB) {
+                continue;
+            }
+            if (header.link >= count) {
+                throw elf_error("object file has no symbol names");
+            }
+            const span<const u8> table        = contents(bytes, header);
+            const span<const u8> symbol_names = contents(bytes, headers[header.link]);
+            for (u64 at = 0; at + SYMBOL_SIZE <= table.size(); at += SYMBOL_SIZE) {
+                const auto index    = load<u16>(table, at + 6);
+                const section where = index < count ? sections[index] : section::SECTION_UNDEFINED;
+                const auto value    = load<u64>(table, at + 8);
+                const bool global   = load<u8>(table, at + 4) >> 4 == STB_GLOBAL;
+                symbols.emplace_back(where, value);
+                if (global && where == section::SECTION_TEXT) {
+                    object.functions_.emplace_back(name_at(symbol_names, load<u32>(table, at)), value);
+                }
+            }
+        }
+
+        for (u16 i = 0; i < count; ++i) {
+            const section_header& header = headers[i];
+            if (header.type != SHT_RELA || header.size == 0) {
+                continue;
+            }
+            if (header.info >= count || sections[header.info] != section::SECTION_TEXT) {
+                throw elf_error("object file has references outside .text");
+            }
+            const span<const u8> table = contents(bytes, header);
+            for (u64 at = 0; at + RELA_SIZE <= table.size(); at += RELA_SIZE) {
+                const auto info   = load<u64>(table, at + 8);
+                const auto type   = CAST<u32>(info);
+                const auto symbol = CAST<u32>(info >> 32);
+                if (type != R_X86_64_PC32 && type != R_X86_64_PLT32) {
+                    throw elf_error("unsupported relocation type in object file: " + std::to_string(type));
+                }
+                if (symbol >= symbols.size() || symbols[symbol].first == section::SECTION_UNDEFINED) {
+                    throw elf_error("object file refers to an undefined symbol");
+                }
+                const auto offset = load<u64>(table, at);
+                if (offset > object.text_.size() || object.text_.size() - offset < 4) {
+                    throw elf_error("relocation outside .text in object file");
+                }
+                const auto [where, target] = symbols[symbol];
+                object.relocations_.push_back({offset, where, target, load<i64>(table, at + 16)});
+            }
+        }
+
+        return object;
+    }
+
+    u64 elf_reader::function(std::string_view name) const {
+        for (const auto& [symbol, offset] : functions_) {
+            if (symbol == name) {
+                return offset;
+            }
+        }
+        throw elf_error("object file does not define " + string(name));
+    }
+}  // namespace mathc
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "elf_object.hpp"
+
+#include <stdexcept>
+
+namespace mathc {
+    class elf_error : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /// @brief The contents of a relocatable ELF64 object file for x86-64, read from its bytes to be linked into an
+    /// `elf_executable`.
+    ///
+    /// Only objects laid out like the prebuilt print runtime (see src/runtime/build.sh) are accepted: code in .text,
+    /// constants in one .rodata and zero-initialized data in one .bss, with only PC-relative references from .text to
+    /// symbols the object defines itself. Anything else throws `elf_error`.
+    class elf_reader {
+    public:
+        using section = elf_object::section;
+
+        /// The 32-bit field at `offset` in .text holds the distance from it to `target` in `where`, plus `addend`
+        struct relocation {
+            u64 offset;
+            section where;
+            u64 target;
+            i64 addend;
+        };
+
+        static elf_reader read(span<const u8> bytes);
+
+        [[nodiscard]] span<const u8> text() const {
+            return text_;
+        }
+
+        [[nodiscard]] span<const u8> rodata() const {
+            return rodata_;
+        }
+
+        [[nodiscard]] u64 rodata_alignment() const {
+            return rodata_alignment_;
+        }
+
+        [[nodiscard]] u64 bss_size() const {
+            return bss_size_;
+        }
+
+        [[nodiscard]] u64 bss_alignment() const {
+            return bss_alignment_;
+        }
+
+        [[nodiscard]] span<const relocation> relocations() const {
+            return relocations_;
+        }
+
+        /// Offset in .text of the global symbol `name`
+        [[nodiscard]] u64 function(std::string_view name) const;
+
+    private:
+        vector<u8> text_;
+        vector<u8> rodata_;
+        u64 rodata_alignment_ = 1;
+        u64 bss_size_         = 0;
+        u64 bss_alignment_    = 1;
+        vector<std::pair<string, u64>> functions_;  // Global symbols in .text
+        vector<relocation> relocations_;
+    };
+}  // namespace mathc
@@ -0,0 +1,234 @@
+#include "float_parser.hpp"
+#include "float_tables.hpp"
+#include "scan_kernels.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstring>
+
+namespace mathc {
+    namespace {
+        constexpr i32 mantissa_explicit_bits = 52;
+        constexpr i32 minimum_exponent       = -1023;
+        constexpr i32 infinite_power         = 0x7FF;
+        constexpr i64 max_exponent_digits    = 0x10000000;  // far beyond any representable power of ten
+        constexpr u64 max_significant_digits = 19;          // largest count that always fits in a u64
+
+        // Powers of ten that are exactly representable as doubles (Clinger's fast path)
+        constexpr f64 exact_powers_of_ten[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                               1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+        struct adjusted_mantissa {
+            u64 mantissa;
+            i32 power2;  // biased exponent; 0x7FF is infinity, -1 means the result could not be computed
+
+            bool operator==(const adjusted_mantissa&) const = default;
+        };
+
+        bool is_digit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        bool is_ident_char(char c) {
+            const char lower = CAST<char>(c | 0x20);
+            return is_digit(c) || (lower >= 'a' && lower <= 'z') || c == '_';
+        }
+
+        u64 load_u64(const char* p) {
+            u64 v;
+            std::memcpy(&v, p, sizeof(v));
+            return v;
+        }
+
+        // SWAR digit parsing (little-endian): checks and converts eight ASCII digits with a handful of multiplies
+        bool is_eight_digits(u64 v) {
+            return (((v + 0x4646464646464646) | (v - 0x3030303030303030)) & 0x8080808080808080) == 0;
+        }
+
+        u32 parse_eight_digits(u64 v) {
+            constexpr u64 mask = 0x000000FF000000FF;
+            constexpr u64 mul1 = 0x000F424000000064;  // 100 + (1000000 << 32)
+            constexpr u64 mul2 = 0x0000271000000001;  // 1 + (10000 << 32)
+            v -= 0x3030303030303030;
+            v = (v * 10) + (v >> 8);
+            v = (((v & mask) * mul1) + (((v >> 16) & mask) * mul2)) >> 32;
+            return CAST<u32>(v);
+        }
+
+        // floor(log2(10^q)) + 63 for q in [-342, 308]
+        i32 power_of_ten_to_power_of_two(i32 q) {
+            return (((152170 + 65536) * q) >> 16) + 63;
+        }
+
+        // Eisel-Lemire: nearest double to w * 10^q for a significand that is exact (no dropped digits)
+        adjusted_mantissa compute_float(i64 q, u64 w) {
+            if (w == 0 || q < float_tables::smallest_power_of_five) {
+                return {0, 0};
+            }
+            if (q > float_tables::largest_power_of_five) {
+                return {0, infinite_power};
+            }
+
+            const i32 lz = std::countl_zero(w);
+            w <<= lz;
+
+            // 55 bits of precision are enough to round correctly; take the second word only when the first product
+            // leaves those bits undetermined (Mushtak & Lemire show this always suffices for exact significands)
+            const size_t index         = 2 * CAST<size_t>(q - float_tables::smallest_power_of_five);
+            constexpr u64 precision    = ~u64(0) >> (mantissa_explicit_bits + 3);
+            u128 first                 = CAST<u128>(w) * float_tables::power_of_five_128[index];
+            u64 high                   = CAST<u64>(first >> 64);
+            u64 low                    = CAST<u64>(first);
+            if ((high & precision) == precision) {
+                const u128 second = CAST<u128>(w) * float_tables::power_of_five_128[index + 1];
+                low += CAST<u64>(second >> 64);
+                if (CAST<u64>(second >> 64) > low) {
+                    ++high;
+                }
+            }
+
+            const i32 upper_bit = CAST<i32>(high >> 63);
+            const i32 shift     = upper_bit + 64 - mantissa_explicit_bits - 3;
+            adjusted_mantissa answer {high >> shift,
+                                      power_of_ten_to_power_of_two(CAST<i32>(q)) + upper_bit - lz - minimum_exponent};
+
+            if (answer.power2 <= 0) {
+                // Subnormal result
+                if (-answer.power2 + 1 >= 64) {
+                    return {0, 0};
+                }
+                answer.mantissa >>= -answer.power2 + 1;
+                answer.mantissa += (answer.mantissa & 1);
+                answer.mantissa >>= 1;
+                answer.power2 = answer.mantissa < (u64(1) << mantissa_explicit_bits) ? 0 : 1;
+                return answer;
+            }
+
+            // Exactly halfway between two doubles can only happen for small |q|; round to even
+            if (low <= 1 && q >= -4 && q <= 23 && (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == high) {
+                answer.mantissa &= ~u64(1);
+            }
+
+            answer.mantissa += (answer.mantissa & 1);
+            answer.mantissa >>= 1;
+            if (answer.mantissa >= (u64(2) << mantissa_explicit_bits)) {
+                answer.mantissa = u64(1) << mantissa_explicit_bits;
+                ++answer.power2;
+            }
+            answer.mantissa &= ~(u64(1) << mantissa_explicit_bits);
+
+            if (answer.power2 >= infinite_power) {
+                return {0, infinite_power};
+            }
+            return answer;
+        }
+
+        f64 to_f64(const adjusted_mantissa& am) {
+            return std::bit_cast<f64>(am.mantissa | (CAST<u64>(am.power2) << mantissa_explicit_bits));
+        }
+
+        // Accumulates a digit run into the significand, keeping the first 19 significant digits
+        struct significand {
+            u64 w      = 0;
+            u64 digits = 0;  // significant digits held in w
+            i64 exp10  = 0;
+            bool truncated = false;
+
+            void consume(const char* p, const char* end, bool fraction) {
+                while (p != end) {
+                    if (w != 0 && digits + 8 <= max_significant_digits && end - p >= 8 &&
+                        is_eight_digits(load_u64(p))) {
+                        w = w * 100000000 + parse_eight_digits(load_u64(p));
+                        digits += 8;
+                        exp10 -= fraction ? 8 : 0;
+                        p += 8;
+                        continue;
+                    }
+
+                    const u64 d = CAST<u64>(*p++ - '0');
+                    if (digits < max_significant_digits) {
+                        w = w * 10 + d;
+                        digits += w != 0 ? 1 : 0;
+                        exp10 -= fraction ? 1 : 0;
+                    } else {
+                        truncated |= d != 0;
+                        exp10 += fraction ? 0 : 1;
+                    }
+                }
+            }
+        };
+    }  // namespace
+
+    bool float_parser::parse(std::string_view src, size_t& pos, f64& out) {
+        const char* data = src.data();
+        const size_t start = pos;
+        significand sig;
+
+        size_t i = scan_kernels::skip_digits(src, pos);
+        sig.consume(data + start, data + i, false);
+
+        if (i < src.size() && data[i] == '.') {
+            const size_t fraction_start = ++i;
+            i = scan_kernels::skip_digits(src, i);
+            sig.consume(data + fraction_start, data + i, true);
+        }
+
+        if (i < src.size() && (data[i] == 'e' || data[i] == 'E')) {
+            size_t j       = i + 1;
+            const bool neg = j < src.size() && data[j] == '-';
+            if (j < src.size() && (data[j] == '-' || data[j] == '+')) {
+                ++j;
+            }
+            if (j >= src.size() || !is_digit(data[j])) {
+                pos = j;
+                return false;
+            }
+
+            i64 exponent = 0;
+            for (; j < src.size() && is_digit(data[j]); ++j) {
+                if (exponent < max_exponent_digits) {
+                    exponent = exponent * 10 + (data[j] - '0');
+                }
+            }
+            sig.exp10 += neg ? -exponent : exponent;
+            i = j;
+        }
+
+        // A literal must not run straight into another '.', a letter or an underscore
+        if (i < src.size() && (data[i] == '.' || is_ident_char(data[i]))) {
+            pos = i;
+            return false;
+        }
+        pos = i;
+
+        if (!sig.truncated) {
+            out = to_double(sig.w, sig.exp10);
+            return true;
+        }
+
+        // Dropped digits only matter if they could move the result across a rounding boundary
+        const adjusted_mantissa lower = compute_float(sig.exp10, sig.w);
+        const adjusted_mantissa upper = compute_float(sig.exp10, sig.w + 1);
+        if (lower == upper) {
+            out = to_f64(lower);
+            return true;
+        }
+
+        std::from_chars(data + start, data + i, out);
+        return true;
+    }
+
+    f64 float_parser::to_double(u64 w, i64 q) {
+        if (w == 0) {
+            return 0.0;
+        }
+
+        // Both w and 10^|q| are exact doubles, so one IEEE operation yields the correctly rounded result
+        if (q >= -22 && q <= 22 && w <= (u64(1) << 53)) {
+            const f64 value = CAST<f64>(w);
+            return q < 0 ? value / exact_powers_of_ten[-q] : value * exact_powers_of_ten[q];
+        }
+
+        return to_f64(compute_float(q, w));
+    }
+}  // namespace mathc
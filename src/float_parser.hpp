@@ -0,0 +1,24 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include <string_view>
+
+namespace mathc {
+    /// @brief Locale-independent, correctly rounded decimal literal parser.
+    ///
+    /// Accepts `digits ['.' [digits]] [('e' | 'E') ['+' | '-'] digits]` with any number of digits. Conversion uses
+    /// Clinger's exact fast path when the significand and exponent are small, and the Eisel-Lemire algorithm
+    /// otherwise. Only literals with more than 19 significant digits that fall right on a rounding boundary are handed
+    /// to `std::from_chars`.
+    class float_parser {
+    public:
+        /// Parses the literal starting at `pos`, which must point at a digit.
+        ///
+        /// On success stores the value in `out`, advances `pos` past the literal and returns true. If the literal is
+        /// malformed (e.g. `1.2.3`, `1e`, `12abc`) returns false with `pos` at the offending character.
+        static bool parse(std::string_view src, size_t& pos, f64& out);
+
+        /// Converts w * 10^q to the nearest double
+        static f64 to_double(u64 w, i64 q);
+    };
+}  // namespace mathc
@@ -0,0 +1,298 @@
+#include "ir.hpp"
+#include "codegen.hpp"
+#include "optimizer.hpp"
+
+#include <iomanip>
+
+namespace mathc {
+    namespace {
+        constexpr symbol_id no_symbol = ir_instruction::no_symbol;
+
+        constexpr ir_opcode binary_opcode(token_type op) {
+            switch (op) {
+                case token_type::TOKEN_ADD:
+                    return ir_opcode::IR_ADD;
+                case token_type::TOKEN_SUBTRACT:
+                    return ir_opcode::IR_SUB;
+                case token_type::TOKEN_MULTIPLY:
+                    return ir_opcode::IR_MUL;
+                case token_type::TOKEN_DIVIDE:
+                    return ir_opcode::IR_DIV;
+                case token_type::TOKEN_FLOOR_DIV:
+                    return ir_opcode::IR_FLOOR_DIV;
+                case token_type::TOKEN_MODULO:
+                    return ir_opcode::IR_MOD;
+                default:
+                    throw codegen_error("Unknown binary operator");
+            }
+        }
+
+        const char* opcode_name(ir_opcode opcode) {
+            static constexpr const char* names[] = {
+                "const", "load", "store", "add", "sub", "mul", "div", "floordiv", "mod", "print",
+            };
+            return names[CAST<size_t>(opcode)];
+        }
+    }  // namespace
+
+    ir_program ir_program::from_ast(const mathc_program& program) {
+        struct work_item {
+            ast_ref ref;
+            bool children_done;
+        };
+
+        ir_program ir;
+        vector<bool> assigned;  // symbol id -> stored by an earlier statement
+        vector<symbol_id> statement_stores;
+        vector<work_item> work;
+        vector<ir_value> values;
+
+        const auto is_assigned = [&assigned](symbol_id symbol) {
+            return symbol < assigned.size() && assigned[symbol];
+        };
+
+        for (const ast_ref statement : program.statements()) {
+            // Post-order walk in source order, so errors come out in the same order code generation reports them
+            work.push_back({statement, false});
+            while (!work.empty()) {
+                const work_item item = work.back();
+                work.pop_back();
+
+                const ast_node& node = program[item.ref];
+                if (!item.children_done) {
+                    switch (node.type) {
+                        case ast_node_type::NODE_BINARY_OP:
+                            work.push_back({item.ref, true});
+                            work.push_back({node.right(), false});
+                            work.push_back({node.left(), false});
+                            continue;
+                        case ast_node_type::NODE_ASSIGN_OP:
+                            work.push_back({item.ref, true});
+                            work.push_back({node.right(), false});
+                            continue;
+                        case ast_node_type::NODE_PRINT_STMT:
+                            work.push_back({item.ref, true});
+                            work.push_back({node.left(), false});
+                            continue;
+                        default:
+                            break;
+                    }
+                }
+
+                switch (node.type) {
+                    case ast_node_type::NODE_NUMBER:
+                        values.push_back(ir.add({ir_opcode::IR_CONST, no_symbol, 0, 0, node.number}));
+                        break;
+                    case ast_node_type::NODE_IDENTIFIER:
+                        if (!is_assigned(node.symbol)) {
+                            throw codegen_error("Undefined variable: " +
+                                                string(symbol_table::global().name(node.symbol)));
+                        }
+                        values.push_back(ir.add({ir_opcode::IR_LOAD, node.symbol, 0, 0, 0.0}));
+                        break;
+                    case ast_node_type::NODE_BINARY_OP: {
+                        const ir_value right = values.back();
+                        values.pop_back();
+                        const ir_value left = values.back();
+                        values.back() = ir.add({binary_opcode(node.op), no_symbol, left, right, 0.0});
+                        break;
+                    }
+                    case ast_node_type::NODE_ASSIGN_OP: {
+                        const ast_node& target = program[node.left()];
+                        if (target.type != ast_node_type::NODE_IDENTIFIER) {
+                            throw codegen_error("Left side of assignment must be an identifier");
+                        }
+
+                        // The assignment evaluates to the stored value; remember the first name it was given so
+                        // `to_ast` can name the variable it lives in
+                        const ir_value value = values.back();
+                        if (ir[value].opcode != ir_opcode::IR_CONST && ir[value].symbol == no_symbol) {
+                            ir[value].symbol = target.symbol;
+                        }
+                        ir.add({ir_opcode::IR_STORE, target.symbol, value, 0, 0.0});
+                        statement_stores.push_back(target.symbol);
+                        break;
+                    }
+                    case ast_node_type::NODE_PRINT_STMT:
+                        // `print(e)` evaluates to `e`, so the print itself never has uses
+                        ir.add({ir_opcode::IR_PRINT, no_symbol, values.back(), 0, 0.0});
+                        break;
+                }
+            }
+            values.clear();
+
+            // Variables become readable from the next statement on, as with `asm_emitter::has_var`
+            for (const symbol_id symbol : statement_stores) {
+                if (symbol >= assigned.size()) {
+                    assigned.resize(symbol + 1);
+                }
+                assigned[symbol] = true;
+            }
+            statement_stores.clear();
+        }
+
+        return ir;
+    }
+
+    mathc_program ir_program::to_ast() const {
+        const size_t n = instructions_.size();
+
+        vector<u32> uses(n);
+        for (const ir_instruction& instruction : instructions_) {
+            if (instruction.is_binary()) {
+                ++uses[instruction.left];
+                ++uses[instruction.right];
+            } else if (instruction.has_effect()) {
+                ++uses[instruction.left];
+            }
+        }
+
+        mathc_program out;
+        out.reserve(n * 2);
+        vector<ast_ref> trees(n);
+        vector<symbol_id> homes(n, no_symbol);
+        unordered_map<symbol_id, u32> home_counts;  // name hint -> homes named after it so far
+
+        // Leaves are created per use, so the result stays a tree even where values are shared
+        const auto operand = [&](ir_value value) {
+            const ir_instruction& instruction = instructions_[value];
+            if (instruction.opcode == ir_opcode::IR_CONST) {
+                return out.add_number(instruction.constant);
+            }
+            if (homes[value] != no_symbol) {
+                return out.add_identifier(homes[value]);
+            }
+            return trees[value];
+        };
+
+        // Homes get names no source identifier can have, so they never collide with a program variable
+        const auto make_home = [&](ir_value value) {
+            const symbol_id hint = instructions_[value].symbol;
+            const u32 count      = ++home_counts[hint];
+            const string base    = hint == no_symbol ? "tmp" : string(symbol_table::global().name(hint));
+            const symbol_id home = symbol_table::global().intern(base + "." + std::to_string(count));
+            homes[value]         = home;
+            out.add_statement(out.add_assign_op(out.add_identifier(home), trees[value]));
+        };
+
+        for (ir_value value = 0; value < n; ++value) {
+            const ir_instruction& instruction = instructions_[value];
+            switch (instruction.opcode) {
+                case ir_opcode::IR_CONST:
+                    break;
+                case ir_opcode::IR_LOAD:
+                    // A later store may change the variable before the use, so the value read here is kept aside
+                    trees[value] = out.add_identifier(instruction.symbol);
+                    if (uses[value] > 0) {
+                        make_home(value);
+                    }
+                    break;
+                case ir_opcode::IR_STORE:
+                    out.add_statement(
+                      out.add_assign_op(out.add_identifier(instruction.symbol), operand(instruction.left)));
+                    break;
+                case ir_opcode::IR_PRINT:
+                    out.add_statement(out.add_print_stmt(operand(instruction.left)));
+                    break;
+                default: {
+                    const ast_ref left  = operand(instruction.left);
+                    const ast_ref right = operand(instruction.right);
+                    trees[value]        = out.add_binary_op(left, instruction.binary_op(), right);
+                    if (uses[value] > 1) {
+                        make_home(value);
+                    }
+                    break;
+                }
+            }
+        }
+
+        return out;
+    }
+
+    vector<f64> ir_program::evaluate() const {
+        vector<f64> values(instructions_.size());
+        vector<f64> variables;  // symbol id -> value last stored
+        vector<f64> printed;
+
+        for (ir_value value = 0; value < instructions_.size(); ++value) {
+            const ir_instruction& instruction = instructions_[value];
+            switch (instruction.opcode) {
+                case ir_opcode::IR_CONST:
+                    values[value] = instruction.constant;
+                    break;
+                case ir_opcode::IR_LOAD:
+                    // `from_ast` rejects loads of variables that have not been stored yet
+                    values[value] = variables[instruction.symbol];
+                    break;
+                case ir_opcode::IR_STORE:
+                    if (instruction.symbol >= variables.size()) {
+                        variables.resize(instruction.symbol + 1);
+                    }
+                    variables[instruction.symbol] = values[instruction.left];
+                    break;
+                case ir_opcode::IR_PRINT:
+                    printed.push_back(values[instruction.left]);
+                    break;
+                default:
+                    values[value] = ast_optimizer::evaluate(instruction.binary_op(), values[instruction.left],
+                                                            values[instruction.right]);
+                    break;
+            }
+        }
+
+        return printed;
+    }
+
+    void ir_program::compact(const vector<bool>& keep) {
+        vector<ir_value> renumbered(instructions_.size());
+        size_t out = 0;
+        for (ir_value value = 0; value < instructions_.size(); ++value) {
+            if (!keep[value]) {
+                continue;
+            }
+
+            ir_instruction instruction = instructions_[value];
+            if (instruction.is_binary()) {
+                instruction.left  = renumbered[instruction.left];
+                instruction.right = renumbered[instruction.right];
+            } else if (instruction.has_effect()) {
+                instruction.left = renumbered[instruction.left];
+            }
+            renumbered[value]     = CAST<ir_value>(out);
+            instructions_[out++] = instruction;
+        }
+        instructions_.resize(out);
+    }
+
+    void ir_program::print(std::ostream& out) const {
+        const auto old_precision = out.precision(17);
+
+        for (ir_value value = 0; value < instructions_.size(); ++value) {
+            const ir_instruction& instruction = instructions_[value];
+            switch (instruction.opcode) {
+                case ir_opcode::IR_STORE:
+                    out << "    store " << symbol_table::global().name(instruction.symbol) << ", %" << instruction.left;
+                    break;
+                case ir_opcode::IR_PRINT:
+                    out << "    print %" << instruction.left;
+                    break;
+                case ir_opcode::IR_CONST:
+                    out << "    %" << value << " = const " << instruction.constant;
+                    break;
+                case ir_opcode::IR_LOAD:
+                    out << "    %" << value << " = load " << symbol_table::global().name(instruction.symbol);
+                    break;
+                default:
+                    out << "    %" << value << " = " << opcode_name(instruction.opcode) << " %" << instruction.left
+                        << ", %" << instruction.right;
+                    if (instruction.symbol != no_symbol) {
+                        out << "  ; " << symbol_table::global().name(instruction.symbol);
+                    }
+                    break;
+            }
+            out << "\n";
+        }
+
+        out.precision(old_precision);
+    }
+}  // namespace mathc
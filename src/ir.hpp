@@ -0,0 +1,99 @@
+#pragma once
+
+#include "ast.hpp"
+
+#include <ostream>
+
+namespace mathc {
+    /// @brief Index of an instruction within its `ir_program`; an instruction and the value it defines are the same
+    using ir_value = u32;
+
+    enum class ir_opcode : u8 {
+        IR_CONST,      // `constant`
+        IR_LOAD,       // current value of variable `symbol`
+        IR_STORE,      // variable `symbol` = `left`
+        IR_ADD,        // `left` + `right`
+        IR_SUB,        // `left` - `right`
+        IR_MUL,        // `left` * `right`
+        IR_DIV,        // `left` / `right`
+        IR_FLOOR_DIV,  // floor(`left` / `right`)
+        IR_MOD,        // `left` - floor(`left` / `right`) * `right`
+        IR_PRINT,      // print `left`
+    };
+
+    struct ir_instruction {
+        static constexpr symbol_id no_symbol = ~symbol_id {0};
+
+        ir_opcode opcode;
+        symbol_id symbol;  // IR_LOAD, IR_STORE; for other values the variable they were first assigned to, if any
+        ir_value left;
+        ir_value right;
+        f64 constant;  // IR_CONST
+
+        [[nodiscard]] bool is_binary() const {
+            return opcode >= ir_opcode::IR_ADD && opcode <= ir_opcode::IR_MOD;
+        }
+
+        /// The operator token of a binary instruction
+        [[nodiscard]] token_type binary_op() const {
+            constexpr token_type tokens[] = {
+                token_type::TOKEN_ADD,    token_type::TOKEN_SUBTRACT,  token_type::TOKEN_MULTIPLY,
+                token_type::TOKEN_DIVIDE, token_type::TOKEN_FLOOR_DIV, token_type::TOKEN_MODULO,
+            };
+            return tokens[CAST<size_t>(opcode) - CAST<size_t>(ir_opcode::IR_ADD)];
+        }
+
+        /// Whether the instruction does anything besides defining its value
+        [[nodiscard]] bool has_effect() const {
+            return opcode == ir_opcode::IR_STORE || opcode == ir_opcode::IR_PRINT;
+        }
+    };
+
+    /// @brief A program as one basic block of SSA instructions.
+    ///
+    /// Programs have no control flow, so every value is defined exactly once, before its uses, and program order is a
+    /// valid schedule. Variables start out as explicit loads and stores; `ir_optimizer` forwards stored values to
+    /// loads, after which variables only exist where something still reads them from memory.
+    class ir_program {
+    public:
+        /// Translates an AST, reporting reads of unassigned variables and assignments to non-variables in source
+        /// order, the same way code generation does
+        static ir_program from_ast(const mathc_program& program);
+
+        /// Rebuilds an AST for code generation. Constants and values used once are folded into the expression that
+        /// uses them; values used more than once are computed once into a variable of their own.
+        [[nodiscard]] mathc_program to_ast() const;
+
+        ir_value add(const ir_instruction& instruction) {
+            instructions_.push_back(instruction);
+            return CAST<ir_value>(instructions_.size() - 1);
+        }
+
+        [[nodiscard]] const ir_instruction& operator[](ir_value value) const {
+            return instructions_[value];
+        }
+
+        [[nodiscard]] ir_instruction& operator[](ir_value value) {
+            return instructions_[value];
+        }
+
+        [[nodiscard]] size_t size() const {
+            return instructions_.size();
+        }
+
+        [[nodiscard]] span<const ir_instruction> instructions() const {
+            return instructions_;
+        }
+
+        /// Runs the program and returns the values it prints, computed the way the generated code computes them
+        [[nodiscard]] vector<f64> evaluate() const;
+
+        /// Keeps only the instructions for which `keep[value]` is set, renumbering values to stay dense
+        void compact(const vector<bool>& keep);
+
+        void print(std::ostream& out) const;
+
+    private:
+        vector<ir_instruction> instructions_;
+    };
+}  // namespace mathc
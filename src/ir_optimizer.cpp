@@ -0,0 +1,177 @@
+#include "ir_optimizer.hpp"
+#include "optimizer.hpp"
+
+#include <bit>
+
+namespace mathc {
+    namespace {
+        constexpr u64 one_bits           = 0x3FF0000000000000;
+        constexpr u64 positive_zero_bits = 0x0000000000000000;
+        constexpr u64 negative_zero_bits = 0x8000000000000000;
+
+        /// What makes two pure instructions compute the same value
+        struct value_key {
+            ir_opcode opcode;
+            ir_value left;
+            ir_value right;
+            u64 bits;  // IR_CONST
+
+            bool operator==(const value_key&) const = default;
+        };
+
+        struct value_key_hash {
+            size_t operator()(const value_key& key) const {
+                constexpr u64 k = 0x9E3779B97F4A7C15;
+                u64 h           = (CAST<u64>(key.opcode) * k) ^ key.bits;
+                h               = (h ^ key.left) * k;
+                h               = (h ^ key.right) * k;
+                return h ^ (h >> 31);
+            }
+        };
+
+        bool is_commutative(ir_opcode opcode) {
+            return opcode == ir_opcode::IR_ADD || opcode == ir_opcode::IR_MUL;
+        }
+    }  // namespace
+
+    void ir_optimizer::optimize() {
+        number_values();
+        eliminate_dead_code();
+    }
+
+    void ir_optimizer::number_values() {
+        ir_program out;
+        vector<ir_value> replacement(program_.size());  // old value -> equivalent value in `out`
+        vector<optional<ir_value>> stored;               // symbol id -> value it holds at this point, in `out`
+        unordered_map<value_key, ir_value, value_key_hash> numbers;
+
+        const auto is_constant = [&out](ir_value value, u64 bits) {
+            return out[value].opcode == ir_opcode::IR_CONST && std::bit_cast<u64>(out[value].constant) == bits;
+        };
+
+        // Returns the existing instruction computing the same value as `instruction`, or adds it
+        const auto number = [&](const ir_instruction& instruction) {
+            const value_key key {instruction.opcode, instruction.left, instruction.right,
+                                 std::bit_cast<u64>(instruction.constant)};
+            const auto [it, inserted] = numbers.try_emplace(key, 0);
+            if (inserted) {
+                it->second = out.add(instruction);
+            } else if (out[it->second].symbol == ir_instruction::no_symbol) {
+                out[it->second].symbol = instruction.symbol;
+            }
+            return it->second;
+        };
+
+        for (ir_value value = 0; value < program_.size(); ++value) {
+            ir_instruction instruction = program_[value];
+            if (instruction.is_binary()) {
+                instruction.left  = replacement[instruction.left];
+                instruction.right = replacement[instruction.right];
+            } else if (instruction.has_effect()) {
+                instruction.left = replacement[instruction.left];
+            }
+
+            switch (instruction.opcode) {
+                case ir_opcode::IR_CONST:
+                    instruction.left = instruction.right = 0;
+                    instruction.symbol = ir_instruction::no_symbol;
+                    replacement[value] = number(instruction);
+                    break;
+                case ir_opcode::IR_LOAD:
+                    // Loads are never numbered: a store between two loads of a variable makes them differ
+                    if (instruction.symbol < stored.size() && stored[instruction.symbol]) {
+                        replacement[value] = *stored[instruction.symbol];
+                    } else {
+                        replacement[value] = out.add(instruction);
+                    }
+                    break;
+                case ir_opcode::IR_STORE:
+                    if (instruction.symbol >= stored.size()) {
+                        stored.resize(instruction.symbol + 1);
+                    }
+                    stored[instruction.symbol] = instruction.left;
+                    replacement[value]         = out.add(instruction);
+                    break;
+                case ir_opcode::IR_PRINT:
+                    replacement[value] = out.add(instruction);
+                    break;
+                default: {
+                    const ir_value left  = instruction.left;
+                    const ir_value right = instruction.right;
+                    const ir_opcode op   = instruction.opcode;
+
+                    if (out[left].opcode == ir_opcode::IR_CONST && out[right].opcode == ir_opcode::IR_CONST) {
+                        const f64 folded =
+                            ast_optimizer::evaluate(instruction.binary_op(), out[left].constant, out[right].constant);
+                        replacement[value] = number({ir_opcode::IR_CONST, ir_instruction::no_symbol, 0, 0, folded});
+                        break;
+                    }
+
+                    if (((op == ir_opcode::IR_MUL || op == ir_opcode::IR_DIV) && is_constant(right, one_bits)) ||
+                        (op == ir_opcode::IR_SUB && is_constant(right, positive_zero_bits)) ||
+                        (op == ir_opcode::IR_ADD && is_constant(right, negative_zero_bits))) {
+                        replacement[value] = left;
+                        break;
+                    }
+                    if ((op == ir_opcode::IR_MUL && is_constant(left, one_bits)) ||
+                        (op == ir_opcode::IR_ADD && is_constant(left, negative_zero_bits))) {
+                        replacement[value] = right;
+                        break;
+                    }
+
+                    if (is_commutative(op) && right < left) {
+                        std::swap(instruction.left, instruction.right);
+                    }
+                    instruction.constant = 0.0;
+                    replacement[value]   = number(instruction);
+                    break;
+                }
+            }
+        }
+
+        program_ = std::move(out);
+    }
+
+    void ir_optimizer::eliminate_dead_code() {
+        // Walking backwards, every use of a value is seen before the value itself
+        vector<bool> live(program_.size());
+        vector<bool> read;  // symbol id -> a live load reads it before the next store to it
+
+        for (ir_value value = CAST<ir_value>(program_.size()); value-- > 0;) {
+            const ir_instruction& instruction = program_[value];
+            switch (instruction.opcode) {
+                case ir_opcode::IR_PRINT:
+                    live[value] = true;
+                    break;
+                case ir_opcode::IR_STORE:
+                    if (instruction.symbol < read.size() && read[instruction.symbol]) {
+                        live[value]              = true;
+                        read[instruction.symbol] = false;
+                    }
+                    break;
+                case ir_opcode::IR_LOAD:
+                    if (live[value]) {
+                        if (instruction.symbol >= read.size()) {
+                            read.resize(instruction.symbol + 1);
+                        }
+                        read[instruction.symbol] = true;
+                    }
+                    break;
+                default:
+                    break;
+            }
+
+            if (!live[value]) {
+                continue;
+            }
+            if (instruction.is_binary()) {
+                live[instruction.left]  = true;
+                live[instruction.right] = true;
+            } else if (instruction.has_effect()) {
+                live[instruction.left] = true;
+            }
+        }
+
+        program_.compact(live);
+    }
+}  // namespace mathc
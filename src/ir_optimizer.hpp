@@ -0,0 +1,27 @@
+#pragma once
+
+#include "ir.hpp"
+
+namespace mathc {
+    /// @brief Whole-program optimization of an `ir_program`.
+    ///
+    /// Two passes, each linear in the number of instructions:
+    ///  - a forward pass that forwards the last value stored to a variable to the loads after it (copy propagation)
+    ///    and gives every computation a value number, so an operator applied to the same operands twice is only
+    ///    computed once (CSE). Operators on constants are evaluated with `ast_optimizer::evaluate`, and `x * 1`,
+    ///    `x / 1`, `x - 0` and `x + -0`, which return `x` exactly, are replaced by `x`.
+    ///  - a backward pass that keeps prints, stores that a later load still reads and whatever those use; everything
+    ///    else, including bare expression statements and stores nobody reads, is removed.
+    class ir_optimizer {
+    public:
+        explicit ir_optimizer(ir_program& program) : program_(program) {}
+
+        void optimize();
+
+    private:
+        ir_program& program_;
+
+        void number_values();
+        void eliminate_dead_code();
+    };
+}  // namespace mathc
@@ -0,0 +1,170 @@
+#include "jit.hpp"
+#include "print_runtime.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace mathc {
+    namespace {
+        constexpr u64 STUB_SIZE = 16;  // jmp [rip + 0] (6 bytes), the 8-byte address, padding
+
+        u64 align_up(u64 value, u64 alignment) {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+
+        /// Calls from the program to the print runtime end up here. The buffer only exists while `run` runs.
+        struct print_hooks {
+            static inline print_buffer* output = nullptr;
+
+            static void print(f64 value) {
+                output->print(value);
+            }
+
+            static void flush() {
+                output->flush();
+            }
+        };
+    }  // namespace
+
+    jit_code::~jit_code() {
+        unload();
+    }
+
+    jit_code::jit_code(jit_code&& other) noexcept {
+        *this = std::move(other);
+    }
+
+    jit_code& jit_code::operator=(jit_code&& other) noexcept {
+        if (this != &other) {
+            unload();
+            text_             = std::move(other.text_);
+            rodata_           = std::move(other.rodata_);
+            rodata_alignment_ = other.rodata_alignment_;
+            bss_size_         = other.bss_size_;
+            entry_            = other.entry_;
+            relocations_      = std::move(other.relocations_);
+            external_calls_   = std::move(other.external_calls_);
+            bindings_         = std::move(other.bindings_);
+            format_           = other.format_;
+            memory_           = std::exchange(other.memory_, nullptr);
+            code_size_        = std::exchange(other.code_size_, 0);
+            size_             = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    void jit_code::set_text(vector<u8> code) {
+        text_ = std::move(code);
+    }
+
+    u64 jit_code::add_rodata(span<const u8> data, u64 alignment) {
+        while (rodata_.size() % alignment != 0) {
+            rodata_.push_back(0);
+        }
+        rodata_alignment_ = std::max(rodata_alignment_, alignment);
+
+        const u64 offset = rodata_.size();
+        rodata_.insert(rodata_.end(), data.begin(), data.end());
+        return offset;
+    }
+
+    void jit_code::set_bss(u64 size) {
+        bss_size_ = size;
+    }
+
+    void jit_code::set_entry(u64 offset) {
+        entry_ = offset;
+    }
+
+    void jit_code::add_relocation(u64 offset, section where, u64 target, i64 addend) {
+        relocations_.push_back({offset, where, target, addend});
+    }
+
+    void jit_code::add_external_call(u64 offset, asm_label label, i64 addend) {
+        external_calls_.push_back({offset, label, addend});
+    }
+
+    void jit_code::bind_print_runtime(print_format format) {
+        format_ = format;
+        bindings_.emplace_back(asm_label::LABEL_PRINT, RCAST<const void*>(&print_hooks::print));
+        bindings_.emplace_back(asm_label::LABEL_FLUSH, RCAST<const void*>(&print_hooks::flush));
+    }
+
+    void jit_code::load() {
+        unload();
+
+        const u64 page_size     = CAST<u64>(sysconf(_SC_PAGESIZE));
+        const u64 stubs_offset  = align_up(text_.size(), 8);
+        const u64 rodata_offset = align_up(stubs_offset + bindings_.size() * STUB_SIZE, rodata_alignment_);
+        const u64 code_size     = align_up(rodata_offset + rodata_.size(), page_size);
+        const u64 size          = code_size + align_up(bss_size_, page_size);
+
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            throw jit_error("could not map memory for the program");
+        }
+        memory_    = CAST<u8*>(memory);
+        code_size_ = code_size;
+        size_      = size;
+
+        std::memcpy(memory_, text_.data(), text_.size());
+        std::memcpy(memory_ + rodata_offset, rodata_.data(), rodata_.size());
+        for (size_t i = 0; i < bindings_.size(); ++i) {
+            static constexpr u8 jump_rip[] = {0xFF, 0x25, 0, 0, 0, 0};  // The address follows the instruction
+            u8* stub                       = memory_ + stubs_offset + i * STUB_SIZE;
+            std::memcpy(stub, jump_rip, sizeof(jump_rip));
+            std::memcpy(stub + sizeof(jump_rip), &bindings_[i].second, sizeof(void*));
+        }
+
+        const auto patch = [this](u64 offset, u64 target, i64 addend) {
+            const i64 distance = CAST<i64>(target) + addend - CAST<i64>(offset);
+            const auto field   = CAST<i32>(distance);
+            std::memcpy(memory_ + offset, &field, sizeof(field));
+        };
+        for (const relocation& r : relocations_) {
+            const u64 base = r.where == section::SECTION_TEXT     ? 0
+                             : r.where == section::SECTION_RODATA ? rodata_offset
+                                                                  : code_size;
+            patch(r.offset, base + r.target, r.addend);
+        }
+        for (const external_call& call : external_calls_) {
+            const auto binding = std::find_if(bindings_.begin(), bindings_.end(),
+                                              [&call](const auto& entry) { return entry.first == call.label; });
+            if (binding == bindings_.end()) {
+                unload();
+                throw jit_error("nothing is bound to a function the program calls");
+            }
+            patch(call.offset, stubs_offset + CAST<u64>(binding - bindings_.begin()) * STUB_SIZE, call.addend);
+        }
+
+        if (mprotect(memory_, code_size_, PROT_READ | PROT_EXEC) != 0) {
+            unload();
+            throw jit_error("could not make the program executable");
+        }
+    }
+
+    i32 jit_code::run() const {
+        if (memory_ == nullptr) {
+            throw jit_error("the program is not loaded");
+        }
+        print_buffer output(format_);
+        print_hooks::output = &output;
+
+        const auto entry = RCAST<i32 (*)()>(memory_ + entry_);
+        const i32 result = entry();
+
+        output.flush();
+        print_hooks::output = nullptr;
+        return result;
+    }
+
+    void jit_code::unload() {
+        if (memory_ != nullptr) {
+            munmap(memory_, size_);
+            memory_ = nullptr;
+        }
+    }
+}  // namespace mathc
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include "asm_instruction.hpp"
+#include "elf_object.hpp"
+#include "options.hpp"
+
+#include <stdexcept>
+
+namespace mathc {
+    class jit_error : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /// @brief A program to run inside the compiler's own process (`--run`).
+    ///
+    /// It is laid out like `elf_executable` lays out a file, but in memory mapped by `load`: .text, a stub for each
+    /// function of this process the code calls, and .rodata share pages that are made read-only and executable once
+    /// everything is in place, and .bss follows on pages that stay writable. The stubs jump on through an absolute
+    /// address, since this process's functions can be further away than a call's 32-bit displacement reaches.
+    class jit_code {
+    public:
+        using section = elf_object::section;
+
+        jit_code() = default;
+        ~jit_code();
+
+        jit_code(jit_code&& other) noexcept;
+        jit_code& operator=(jit_code&& other) noexcept;
+        jit_code(const jit_code&)            = delete;
+        jit_code& operator=(const jit_code&) = delete;
+
+        void set_text(vector<u8> code);
+
+        /// Appends `data` to .rodata at a multiple of `alignment`, returning its offset
+        u64 add_rodata(span<const u8> data, u64 alignment);
+
+        void set_bss(u64 size);
+
+        /// Runs the program from `offset` in .text, which must be a function returning an int
+        void set_entry(u64 offset);
+
+        /// Fills in the 32-bit field at `offset` in .text with the distance from it to `target` in `where`, plus
+        /// `addend`
+        void add_relocation(u64 offset, section where, u64 target, i64 addend);
+
+        /// Points the call whose 32-bit field is at `offset` in .text at the function bound to `label`
+        void add_external_call(u64 offset, asm_label label, i64 addend);
+
+        /// Binds the print runtime's labels to functions of this process that format values as `format` says and
+        /// write them to stdout
+        void bind_print_runtime(print_format format);
+
+        /// Maps the program into memory, ready to `run`. Throws `jit_error` if that fails or a called label is unbound.
+        void load();
+
+        /// Runs the loaded program, returning its exit code. Everything it printed has been written out by then.
+        [[nodiscard]] i32 run() const;
+
+    private:
+        struct relocation {
+            u64 offset;
+            section where;
+            u64 target;
+            i64 addend;
+        };
+
+        struct external_call {
+            u64 offset;
+            asm_label label;
+            i64 addend;
+        };
+
+        vector<u8> text_;
+        vector<u8> rodata_;
+        u64 rodata_alignment_ = 1;
+        u64 bss_size_         = 0;
+        u64 entry_            = 0;
+        vector<relocation> relocations_;
+        vector<external_call> external_calls_;
+        vector<std::pair<asm_label, const void*>> bindings_;
+        print_format format_ = print_format::PRINT_G15;
+
+        u8* memory_       = nullptr;  // The mapping, once loaded
+        size_t code_size_ = 0;        // Bytes of it that are executable
+        size_t size_      = 0;
+
+        void unload();
+    };
+}  // namespace mathc
@@ -1,10 +1,23 @@
+#include "bytecode.hpp"
 #include "codegen.hpp"
+#include "ir.hpp"
+#include "ir_optimizer.hpp"
+#include "optimizer.hpp"
+#include "options.hpp"
 #include "parser.hpp"
+#include "print_runtime.hpp"
 #include "scanner.hpp"
 #include "assembler.hpp"
+#include "scan_kernels.hpp"
 #include "source.hpp"
+#include "target.hpp"
+#include "watch.hpp"
 #include "version.h"
 
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cstring>
 #include <filesystem>
 #include <fstream>
@@ -20,32 +33,99 @@ using namespace mathc;
         return r;                                                                                                      \
     }
 
-static i32 get_program(const string& input, mathc_program& program_out) {
-    token_scanner scanner(input);
-    expr_parser parser(scanner);
+// What to print about the compilation besides building the program
+struct report_options {
+    bool variables  = false;  // --print-vars
+    bool var_layout = false;  // --var-layout=dump
+    bool strength   = false;  // --strength-report
+    bool time       = false;  // --time, with --run or --interpret
+    bool bytecode   = false;  // --dump-bytecode, with --interpret
+};
 
+static i32 get_program(std::string_view input, mathc_program& program_out) {
     try {
+        token_scanner scanner(input);
+        const token_stream tokens = scanner.scan_all();
+
+        expr_parser parser(tokens);
         program_out = parser.parse_program();
         return 0;
+    } catch (const scan_error& e) {
+        std::cerr << "error: " << e.what() << "\n";
+        return 1;
     } catch (const parse_error& e) {
         std::cerr << "error: " << e.what() << "\n";
         return 1;
     }
 }
 
-static i32 generate_assembly(const mathc_program& program, string& asm_out, bool print_vars) {
-    code_generator codegen;
+// Runs the program through the IR. With --emit=ir the IR is printed instead of being turned back into an AST.
+static i32 optimize_ir(mathc_program& program, const compile_options& options) {
+    try {
+        ir_program ir = ir_program::from_ast(program);
+        if (options.level != opt_level::O0) {
+            ir_optimizer(ir).optimize();
+        }
+
+        if (options.emit == emit_kind::EMIT_IR) {
+            ir.print(std::cout);
+        } else {
+            program = ir.to_ast();
+        }
+        return 0;
+    } catch (const codegen_error& e) {
+        std::cerr << "error: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static void print_strength_report(span<const strength_rewrite> rewrites) {
+    const auto old_precision = std::cout.precision(17);
+    for (const strength_rewrite& rewrite : rewrites) {
+        const char* op = rewrite.op == token_type::TOKEN_DIVIDE      ? "/"
+                         : rewrite.op == token_type::TOKEN_FLOOR_DIV ? "//"
+                                                                     : "%";
+        std::cout << "statement " << rewrite.statement + 1 << ": x " << op << " " << rewrite.divisor << " => "
+                  << rewrite.replacement << "\n";
+    }
+    std::cout.precision(old_precision);
+    std::cout << rewrites.size() << " rewrites\n";
+}
+
+static i32 generate_code(const mathc_program& program,
+                         const compile_options& options,
+                         program_output& out,
+                         const report_options& reports) {
+    code_generator codegen(options);
 
     try {
         codegen.generate_program(program);
-        asm_out = codegen.get_asm();
-
-        if (print_vars) {
+        if (options.peephole) {
+            codegen.get_emitter().run_peephole();
+        }
+        if (options.fp_contract) {
+            codegen.get_emitter().contract_multiply_adds();
+        }
+        if (reports.variables) {
             std::cout << "\n";
             std::cout << "=== VARIABLES ===\n";
             codegen.get_emitter().print_variables();
         }
 
+        if (reports.var_layout) {
+            std::cout << "\n";
+            std::cout << "=== VARIABLE LAYOUT ===\n";
+            codegen.get_emitter().get_layout().dump(std::cout);
+        }
+
+        if (reports.strength) {
+            std::cout << "\n";
+            std::cout << "=== STRENGTH REDUCTION ===\n";
+            print_strength_report(codegen.get_rewrites());
+        }
+
+        // Last, since NASM source consumes the code the reports are made from
+        out = codegen.take_output();
         return 0;
     } catch (const codegen_error& e) {
         std::cerr << "error: " << e.what() << "\n";
@@ -53,31 +133,93 @@ static i32 generate_assembly(const mathc_program& program, string& asm_out, bool
     }
 }
 
-static i32 write_asm_to_disk(const string& assembly, const path& output_path) {
-    std::ofstream asm_out(output_path);
+// Runs the program in the compiler. The executable only writes out what the program would have printed.
+static i32 precompute(const mathc_program& program, const compile_options& options, program_output& out) {
+    try {
+        string output;
+        for (const f64 value : ir_program::from_ast(program).evaluate()) {
+            print_runtime::format(value, options.format, output);
+        }
+        if (options.emit == emit_kind::EMIT_ASM) {
+            out.assembly = asm_emitter::get_precomputed_code(output);
+        } else if (options.emit == emit_kind::EMIT_OBJECT) {
+            out.object = asm_emitter::get_precomputed_object(output);
+        } else {
+            out.executable = asm_emitter::get_precomputed_executable(output);
+        }
+        return 0;
+    } catch (const codegen_error& e) {
+        std::cerr << "error: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static i32 write_to_disk(std::string_view data, const path& output_path) {
+    std::ofstream out(output_path, std::ios::binary);
 
-    if (!asm_out.is_open()) {
+    if (!out.is_open()) {
         std::cerr << "error: failed to open output file for writing\n";
         return 1;
     }
 
-    asm_out << assembly;
-    asm_out.close();
+    out << data;
+    out.close();
+
+    return 0;
+}
+
+// Writes `text` block by block with writev, without first joining its sections into one string
+static i32 write_to_disk(span<const chunked_buffer> text, const path& output_path) {
+    const int fd = open(output_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1) {
+        std::cerr << "error: failed to open output file for writing\n";
+        return 1;
+    }
 
+    const bool written = chunked_buffer::write_to(fd, text);
+    const bool closed  = close(fd) == 0;
+    if (!written || !closed) {
+        std::cerr << "error: failed to write " << output_path.string() << "\n";
+        return 1;
+    }
     return 0;
 }
 
-static i32 cleanup_build_artifacts(const path& asm_file, const path& obj_file) {
-    if (exists(asm_file)) {
-        if (!remove(asm_file)) {
-            std::cerr << "error: failed to delete file: " << absolute(asm_file) << "\n";
+// Writes `bytes` as an executable file in one system call
+static i32 write_executable(span<const u8> bytes, const path& output_path) {
+    // Replace the file rather than overwriting it, which fails while the old executable is still running
+    unlink(output_path.c_str());
+    const int fd = open(output_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0755);
+    if (fd == -1) {
+        std::cerr << "error: failed to open output file for writing\n";
+        return 1;
+    }
+
+    size_t written = 0;
+    while (written < bytes.size()) {
+        const ssize_t result = write(fd, bytes.data() + written, bytes.size() - written);
+        if (result <= 0) {
+            close(fd);
+            std::cerr << "error: failed to write " << output_path.string() << "\n";
             return 1;
         }
+        written += CAST<size_t>(result);
     }
 
-    if (exists(obj_file)) {
-        if (!remove(obj_file)) {
-            std::cerr << "error: failed to delete file: " << absolute(obj_file) << "\n";
+    // The mode passed to open only applies when it creates the file
+    const bool ok = fchmod(fd, 0755) == 0;
+    close(fd);
+    if (!ok) {
+        std::cerr << "error: failed to make " << output_path.string() << " executable\n";
+        return 1;
+    }
+    return 0;
+}
+
+static i32 cleanup_build_artifacts(std::initializer_list<path> files) {
+    for (const path& file : files) {
+        if (exists(file) && !remove(file)) {
+            std::cerr << "error: failed to delete file: " << absolute(file) << "\n";
             return 1;
         }
     }
@@ -85,46 +227,165 @@ static i32 cleanup_build_artifacts(const path& asm_file, const path& obj_file) {
     return 0;
 }
 
-static i32 compile(const char* filename, bool print_vars) {
+// Writes the program as build/<stem> next to the source file. With --emit=asm it is assembled with NASM from its
+// source, which is kept for reading, and linked with the print runtime unless it was precomputed. With --emit=obj
+// only the object file build/<stem>.o is written, next to the print runtime it links with, build/<stem>_runtime.o;
+// `exe_path` is then the object file.
+static i32 build_executable(const program_output& program,
+                            const path& filename,
+                            const compile_options& options,
+                            path& exe_path) {
+    // Create output directory
+    const string filename_no_ext = filename.stem().string();
+    const path source_root       = filename.parent_path();
+    const path build_path        = source_root / "build";
+    if (!exists(build_path)) {
+        fs::create_directory(build_path);
+    }
+    const path assembly_path = build_path / (filename_no_ext + ".s");
+    const path runtime_path  = build_path / (filename_no_ext + "_runtime.o");
+    const path obj_path      = build_path / (filename_no_ext + ".o");
+    exe_path                 = build_path / (filename_no_ext);
+
+    if (options.emit == emit_kind::EMIT_OBJECT) {
+        exe_path   = obj_path;
+        i32 result = write_to_disk({RCAST<const char*>(program.object.data()), program.object.size()}, obj_path);
+        if (result != 0 || options.precompute) {
+            return result;
+        }
+        const span<const u8> runtime = print_runtime::object(options.format);
+        return write_to_disk({RCAST<const char*>(runtime.data()), runtime.size()}, runtime_path);
+    }
+    if (options.emit != emit_kind::EMIT_ASM) {
+        return write_executable(program.executable, exe_path);
+    }
+
+    i32 result = write_to_disk(program.assembly, assembly_path);
+    CHECK_RESULT(result);
+    result = assembler::run_nasm(assembly_path, obj_path);
+    CHECK_RESULT(result);
+
+    // Precomputed programs print nothing at run time and are linked without the runtime
+    if (options.precompute) {
+        result = assembler::run_standalone_linker(obj_path, exe_path);
+        CHECK_RESULT(result);
+        return cleanup_build_artifacts({obj_path});
+    }
+
+    const span<const u8> runtime = print_runtime::object(options.format);
+    result = write_to_disk({RCAST<const char*>(runtime.data()), runtime.size()}, runtime_path);
+    CHECK_RESULT(result);
+    if (options.freestanding) {
+        result = assembler::run_freestanding_linker(obj_path, runtime_path, exe_path);
+    } else {
+        result = assembler::run_linker(obj_path, runtime_path, exe_path);
+    }
+    CHECK_RESULT(result);
+
+    return cleanup_build_artifacts({runtime_path, obj_path});
+}
+
+// Runs the program in this process. With --time, how long it took to compile (since `start`) and to run goes to stderr.
+static i32 run_program(jit_code& jit,
+                       const compile_options& options,
+                       const report_options& reports,
+                       std::chrono::high_resolution_clock::time_point start) {
+    jit.bind_print_runtime(options.format);
+    jit.load();
+
+    const auto loaded = std::chrono::high_resolution_clock::now();
+    const i32 result  = jit.run();
+    const auto end    = std::chrono::high_resolution_clock::now();
+
+    if (reports.time) {
+        const auto milliseconds = [](auto elapsed) { return std::chrono::duration<f64, std::milli>(elapsed).count(); };
+        std::cerr << "Compiled in " << milliseconds(loaded - start) << "ms, ran in " << milliseconds(end - loaded)
+                  << "ms\n";
+    }
+    return result;
+}
+
+// Runs the program on the bytecode interpreter, timed like `run_program`
+static i32 interpret(const mathc_program& program,
+                     const compile_options& options,
+                     const report_options& reports,
+                     std::chrono::high_resolution_clock::time_point start) {
+    try {
+        const bytecode_program bytecode = bytecode_program::from_ast(program);
+        if (reports.bytecode) {
+            bytecode.print(std::cout);
+            std::cout << "\n";
+            std::cout.flush();
+        }
+
+        const auto lowered = std::chrono::high_resolution_clock::now();
+        bytecode.run(options.format);
+        const auto end = std::chrono::high_resolution_clock::now();
+
+        if (reports.time) {
+            const auto milliseconds = [](auto elapsed) {
+                return std::chrono::duration<f64, std::milli>(elapsed).count();
+            };
+            std::cerr << "Compiled in " << milliseconds(lowered - start) << "ms, ran in " << milliseconds(end - lowered)
+                      << "ms\n";
+        }
+        return 0;
+    } catch (const codegen_error& e) {
+        std::cerr << "error: " << e.what() << "\n";
+        return 1;
+    }
+}
+
+static i32 compile(const char* filename, const compile_options& options, const report_options& reports) {
     const auto start = std::chrono::high_resolution_clock::now();
 
     path exe_path;
     try {
         source_code source(filename);
 
-        std::cout << "[1/1] " << filename << "\n";
+        // Keep stdout clean for --emit=ir so the dump can be piped, and for --run and --interpret so it is only the
+        // program's output
+        if (options.emit != emit_kind::EMIT_IR && options.emit != emit_kind::EMIT_RUN &&
+            options.emit != emit_kind::EMIT_INTERPRET) {
+            std::cout << "[1/1] " << filename << "\n";
+        }
 
         mathc_program program;
         i32 result = get_program(source.get_str(), program);
         CHECK_RESULT(result)
 
-        string assembly;
-        result = generate_assembly(program, assembly, print_vars);
-        CHECK_RESULT(result);
-
-        // Create output directory
-        const string filename_no_ext = path(filename).stem().string();
-        const path source_root       = path(filename).parent_path();
-        const path build_path        = source_root / "build";
-        if (!exists(build_path)) {
-            fs::create_directory(build_path);
-        }
-        const path assembly_path = build_path / (filename_no_ext + ".s");
-
-        result = write_asm_to_disk(assembly, assembly_path);
-        CHECK_RESULT(result);
+        program_output output;
+        // --run and --interpret run the program anyway, so they have nothing to gain from precomputing it
+        if (options.precompute && options.emit != emit_kind::EMIT_RUN && options.emit != emit_kind::EMIT_INTERPRET &&
+            options.emit != emit_kind::EMIT_IR) {
+            result = precompute(program, options, output);
+            CHECK_RESULT(result);
+        } else {
+            if (options.level != opt_level::O0) {
+                program = ast_optimizer(program).optimize_program();
+            }
 
-        const path obj_path = build_path / (filename_no_ext + ".o");
+            if (options.level != opt_level::O0 || options.emit == emit_kind::EMIT_IR) {
+                result = optimize_ir(program, options);
+                CHECK_RESULT(result);
+                if (options.emit == emit_kind::EMIT_IR) {
+                    return 0;
+                }
+            }
 
-        result = assembler::run_nasm(assembly_path, obj_path);
-        CHECK_RESULT(result);
+            if (options.emit == emit_kind::EMIT_INTERPRET) {
+                return interpret(program, options, reports, start);
+            }
 
-        exe_path = build_path / (filename_no_ext);
+            result = generate_code(program, options, output, reports);
+            CHECK_RESULT(result);
+        }
 
-        result = assembler::run_linker(obj_path, exe_path);
-        CHECK_RESULT(result);
+        if (options.emit == emit_kind::EMIT_RUN) {
+            return run_program(output.jit, options, reports, start);
+        }
 
-        result = cleanup_build_artifacts(assembly_path, obj_path);
+        result = build_executable(output, filename, options, exe_path);
         CHECK_RESULT(result);
     } catch (const std::exception& e) {
         std::cerr << "error: " << e.what() << "\n";
@@ -140,6 +401,28 @@ static i32 compile(const char* filename, bool print_vars) {
     return 0;
 }
 
+static i32 watch(const char* filename, const compile_options& options) {
+    // Watch mode always generates code, which needs the runtime
+    compile_options build_options = options;
+    build_options.precompute      = false;
+
+    watch_session session(filename, build_options, [filename, &build_options](const program_output& program) {
+        try {
+            path exe_path;
+            const i32 result = build_executable(program, filename, build_options, exe_path);
+            if (result == 0) {
+                std::cout << "=> " << fs::absolute(exe_path).string() << "\n";
+            }
+            return result;
+        } catch (const std::exception& e) {
+            std::cerr << "error: " << e.what() << "\n";
+            return 1;
+        }
+    });
+
+    return session.run();
+}
+
 static string make_help_text() {
     std::ostringstream oss;
     oss << "\n";
@@ -150,7 +433,35 @@ static string make_help_text() {
     oss << "  mathc <source_file> [args..]\n";
     oss << "\n";
     oss << "ARGUMENTS\n";
+    oss << "  -O0           Compiles the program as written\n";
+    oss << "  -O1           Folds constants, removes repeated and unused computations (default)\n";
     oss << "  --print-vars  Prints the program's variables to the console\n";
+    oss << "  --var-layout=dump\n";
+    oss << "                Prints each variable's offset, cache line and access count\n";
+    oss << "  --no-simd     Scans the source with the scalar kernels instead of SSE2/AVX2\n";
+    oss << "  --no-peephole Emits the generated instructions without peephole optimization\n";
+    oss << "  --no-strength-reduction\n";
+    oss << "                Divides by constants with divsd even where a multiplication gives the same result\n";
+    oss << "  --strength-report\n";
+    oss << "                Prints every division by a constant that was replaced by cheaper instructions\n";
+    oss << "  --no-slp      Emits scalar code only, without packing similar statements into SSE2 or AVX instructions\n";
+    oss << "  --print=shortest\n";
+    oss << "                Prints values with the fewest digits that read back exactly, instead of like %.15g\n";
+    oss << "  --march=<level>\n";
+    oss << "                Targets x86-64, x86-64-v2 (default), x86-64-v3 (AVX2 and FMA) or the native CPU\n";
+    oss << "  --fp-contract Fuses multiplications and the additions after them into FMA instructions (x86-64-v3)\n";
+    oss << "  --freestanding\n";
+    oss << "                With --emit=asm or --emit=obj, starts at its own _start to link statically without libc\n";
+    oss << "  --precompute  Runs the program while compiling; the executable only writes out its output\n";
+    oss << "  --emit=ir     Prints the intermediate representation instead of building\n";
+    oss << "  --emit=asm    Builds through NASM from assembly source, kept as build/<name>.s\n";
+    oss << "  --emit=obj    Writes the object file build/<name>.o and the print runtime to link it with instead\n";
+    oss << "  --run         Runs the program in the compiler's process instead of building an executable\n";
+    oss << "  --interpret   Runs the program on a bytecode interpreter, without NASM or GCC\n";
+    oss << "  --dump-bytecode\n";
+    oss << "                With --interpret, prints the bytecode before running it\n";
+    oss << "  --time        With --run or --interpret, prints how long compiling and running the program took\n";
+    oss << "  --watch       Rebuilds the program every time the source file is saved\n";
     return oss.str();
 }
 
@@ -166,15 +477,68 @@ int main(int argc, char* argv[]) {
         return 0;
     }
 
-    bool print_vars = false;
+    report_options reports;
+    bool watch_mode = false;
+    compile_options options;
     if (argc > 2) {
         for (int i = 2; i < argc; ++i) {
             const auto arg = argv[i];
             if (std::strcmp(arg, "--print-vars") == 0) {
-                print_vars = true;
+                reports.variables = true;
+            } else if (std::strcmp(arg, "--var-layout=dump") == 0) {
+                reports.var_layout = true;
+            } else if (std::strcmp(arg, "--strength-report") == 0) {
+                reports.strength = true;
+            } else if (std::strcmp(arg, "--no-simd") == 0) {
+                scan_kernels::set_isa(scan_isa::ISA_SCALAR);
+            } else if (std::strcmp(arg, "--watch") == 0) {
+                watch_mode = true;
+            } else if (std::strcmp(arg, "-O0") == 0) {
+                options.level = opt_level::O0;
+            } else if (std::strcmp(arg, "-O1") == 0) {
+                options.level = opt_level::O1;
+            } else if (std::strcmp(arg, "--no-peephole") == 0) {
+                options.peephole = false;
+            } else if (std::strcmp(arg, "--no-strength-reduction") == 0) {
+                options.strength_reduce = false;
+            } else if (std::strcmp(arg, "--no-slp") == 0) {
+                options.vectorize = false;
+            } else if (std::strcmp(arg, "--print=shortest") == 0) {
+                options.format = print_format::PRINT_SHORTEST;
+            } else if (std::strcmp(arg, "--precompute") == 0) {
+                options.precompute = true;
+            } else if (std::strcmp(arg, "--emit=ir") == 0) {
+                options.emit = emit_kind::EMIT_IR;
+            } else if (std::strcmp(arg, "--emit=asm") == 0) {
+                options.emit = emit_kind::EMIT_ASM;
+            } else if (std::strcmp(arg, "--emit=obj") == 0) {
+                options.emit = emit_kind::EMIT_OBJECT;
+            } else if (std::strcmp(arg, "--run") == 0) {
+                options.emit = emit_kind::EMIT_RUN;
+            } else if (std::strcmp(arg, "--interpret") == 0) {
+                options.emit = emit_kind::EMIT_INTERPRET;
+            } else if (std::strcmp(arg, "--dump-bytecode") == 0) {
+                reports.bytecode = true;
+            } else if (std::strcmp(arg, "--time") == 0) {
+                reports.time = true;
+            } else if (std::strncmp(arg, "--march=", 8) == 0) {
+                const optional<target_arch> arch = target_info::parse(arg + 8);
+                if (!arch) {
+                    std::cerr << "error: unknown target '" << arg + 8 << "'\n";
+                    return 1;
+                }
+                options.arch = *arch;
+            } else if (std::strcmp(arg, "--fp-contract") == 0) {
+                options.fp_contract = true;
+            } else if (std::strcmp(arg, "--freestanding") == 0) {
+                options.freestanding = true;
             }
         }
     }
 
-    return compile(argv[1], print_vars);
+    if (watch_mode) {
+        return watch(argv[1], options);
+    }
+
+    return compile(argv[1], options, reports);
 }
@@ -0,0 +1,136 @@
+#include "optimizer.hpp"
+
+#include <cmath>
+
+namespace mathc {
+    mathc_program ast_optimizer::optimize_program() {
+        mathc_program out;
+        out.reserve(source_.node_count());
+
+        for (const ast_ref statement : source_.statements()) {
+            out.add_statement(optimize_statement(statement, out));
+        }
+
+        return out;
+    }
+
+    ast_ref ast_optimizer::optimize_statement(ast_ref root, mathc_program& out) {
+        // Post-order walk on an explicit stack, like code generation, so deeply nested expressions are fine
+        work_.clear();
+        results_.clear();
+        work_.push_back({root, false, false});
+
+        while (!work_.empty()) {
+            const work_item item = work_.back();
+            work_.pop_back();
+
+            const ast_node& node = source_[item.ref];
+            if (!item.children_done) {
+                switch (node.type) {
+                    case ast_node_type::NODE_BINARY_OP:
+                        work_.push_back({item.ref, true, false});
+                        work_.push_back({node.right(), false, false});
+                        work_.push_back({node.left(), false, false});
+                        continue;
+                    case ast_node_type::NODE_ASSIGN_OP:
+                        // The value is evaluated before the target is written, so reads in it see the old value
+                        work_.push_back({item.ref, true, false});
+                        work_.push_back({node.left(), false, true});
+                        work_.push_back({node.right(), false, false});
+                        continue;
+                    case ast_node_type::NODE_PRINT_STMT:
+                        work_.push_back({item.ref, true, false});
+                        work_.push_back({node.left(), false, false});
+                        continue;
+                    default:
+                        break;
+                }
+            }
+
+            switch (node.type) {
+                case ast_node_type::NODE_NUMBER:
+                    results_.push_back({out.add_number(node.number), true, node.number});
+                    break;
+                case ast_node_type::NODE_IDENTIFIER: {
+                    const optional<f64> value = item.is_target ? std::nullopt : constant(node.symbol);
+                    if (value) {
+                        results_.push_back({out.add_number(*value), true, *value});
+                    } else {
+                        results_.push_back({out.add_identifier(node.symbol), false, 0.0});
+                    }
+                    break;
+                }
+                case ast_node_type::NODE_BINARY_OP: {
+                    const folded right = results_.back();
+                    results_.pop_back();
+                    const folded left = results_.back();
+                    results_.pop_back();
+
+                    if (left.is_constant && right.is_constant) {
+                        const f64 value = evaluate(node.op, left.value, right.value);
+                        results_.push_back({out.add_number(value), true, value});
+                    } else {
+                        results_.push_back({out.add_binary_op(left.ref, node.op, right.ref), false, 0.0});
+                    }
+                    break;
+                }
+                case ast_node_type::NODE_ASSIGN_OP: {
+                    const folded target = results_.back();
+                    results_.pop_back();
+                    const folded value = results_.back();
+                    results_.pop_back();
+
+                    // Anything but an identifier on the left is rejected by code generation
+                    const ast_node& target_node = source_[node.left()];
+                    if (target_node.type == ast_node_type::NODE_IDENTIFIER) {
+                        assign(target_node.symbol, value.is_constant ? optional<f64>(value.value) : std::nullopt);
+                    }
+
+                    // An assignment evaluates to the value it stores (e.g. the inner `y = 3` of `x = y = 3`)
+                    results_.push_back({out.add_assign_op(target.ref, value.ref), value.is_constant, value.value});
+                    break;
+                }
+                case ast_node_type::NODE_PRINT_STMT: {
+                    const ast_ref expr = results_.back().ref;
+                    results_.back()    = {out.add_print_stmt(expr), false, 0.0};
+                    break;
+                }
+            }
+        }
+
+        return results_.back().ref;
+    }
+
+    f64 ast_optimizer::evaluate(token_type op, f64 left, f64 right) {
+        // Each step is a single IEEE double operation, matching the instruction sequences in `asm_emitter`
+        switch (op) {
+            case token_type::TOKEN_ADD:
+                return left + right;
+            case token_type::TOKEN_SUBTRACT:
+                return left - right;
+            case token_type::TOKEN_MULTIPLY:
+                return left * right;
+            case token_type::TOKEN_DIVIDE:
+                return left / right;
+            case token_type::TOKEN_FLOOR_DIV:
+                return std::floor(left / right);
+            case token_type::TOKEN_MODULO: {
+                const f64 product = std::floor(left / right) * right;
+                return left - product;
+            }
+            default:
+                return std::nan("");
+        }
+    }
+
+    void ast_optimizer::assign(symbol_id symbol, optional<f64> value) {
+        if (symbol >= constants_.size()) {
+            constants_.resize(symbol + 1);
+        }
+        constants_[symbol] = value;
+    }
+
+    optional<f64> ast_optimizer::constant(symbol_id symbol) const {
+        return symbol < constants_.size() ? constants_[symbol] : std::nullopt;
+    }
+}  // namespace mathc
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ast.hpp"
+
+namespace mathc {
+    /// @brief Constant folding and propagation over the AST.
+    ///
+    /// A program is straight-line code, so the value of every variable is known at each point it is read if the last
+    /// assignment to it stored a constant. Statements are rewritten in program order into a new `ast_program`: reads
+    /// of such variables become literals and operators whose operands are both literals are evaluated. Folding uses
+    /// the same double-precision operations the generated code would, so results are bit-identical; in particular `//`
+    /// and `%` round toward negative infinity like `roundsd` with mode 1.
+    ///
+    /// Assignments are kept even when their value is known, and reads of variables that have not been assigned yet
+    /// are left alone so code generation still reports them.
+    class ast_optimizer {
+    public:
+        explicit ast_optimizer(const mathc_program& source) : source_(source) {}
+
+        /// Rewrites every statement of the source program
+        mathc_program optimize_program();
+
+        /// Rewrites the statement at `root` into `out`, given the constants assigned by the statements before it,
+        /// and returns the new root
+        ast_ref optimize_statement(ast_ref root, mathc_program& out);
+
+        /// Evaluates a binary operator exactly as the generated code does
+        [[nodiscard]] static f64 evaluate(token_type op, f64 left, f64 right);
+
+    private:
+        struct work_item {
+            ast_ref ref;
+            bool children_done;
+            bool is_target;  // the variable an assignment stores to, which must not be replaced by its value
+        };
+
+        struct folded {
+            ast_ref ref;
+            bool is_constant;
+            f64 value;
+        };
+
+        const mathc_program& source_;
+        vector<optional<f64>> constants_;  // symbol id -> current value, if it is a known constant
+        vector<work_item> work_;
+        vector<folded> results_;
+
+        void assign(symbol_id symbol, optional<f64> value);
+        [[nodiscard]] optional<f64> constant(symbol_id symbol) const;
+    };
+}  // namespace mathc
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "mathc_common.hpp"
+
+namespace mathc {
+    /// @brief Optimization levels selected with `-O<n>`
+    enum class opt_level : u8 {
+        O0,  // compile the AST as written
+        O1,  // fold constants, then number values and remove dead code in the IR
+    };
+
+    /// @brief What `--emit=<kind>` asks the compiler to produce
+    enum class emit_kind : u8 {
+        EMIT_EXECUTABLE,  // encode the program and link build/<name>
+        EMIT_ASM,         // like EMIT_EXECUTABLE, but through NASM, keeping its source build/<name>.s
+        EMIT_OBJECT,      // encode the program into the object file build/<name>.o, to be linked with the print runtime
+        EMIT_RUN,         // run the program in the compiler's process, writing no files
+        EMIT_INTERPRET,   // run the program on the bytecode interpreter, needing no assembler or linker
+        EMIT_IR,          // print the IR to stdout and stop
+    };
+
+    /// @brief How `print` statements write their value (`--print=<format>`)
+    enum class print_format : u8 {
+        PRINT_G15,       // like printf("%.15g\n")
+        PRINT_SHORTEST,  // the fewest significant digits that read back as the same double
+    };
+
+    /// @brief x86-64 microarchitecture level the generated code may use (`--march=<level>`)
+    enum class target_arch : u8 {
+        ARCH_X86_64,     // SSE2 only: floor is computed without roundsd
+        ARCH_X86_64_V2,  // adds SSE4.1 roundsd/roundpd
+        ARCH_X86_64_V3,  // adds AVX2 and FMA: VEX-encoded three-operand instructions
+    };
+
+    /// @brief Command line settings that change the generated code
+    struct compile_options {
+        opt_level level      = opt_level::O1;
+        bool peephole        = true;  // clean up the instruction list with `peephole_optimizer`
+        bool vectorize       = true;  // evaluate runs of isomorphic statements with packed instructions
+        bool strength_reduce = true;  // divide by powers of two with exact multiplications
+        emit_kind emit       = emit_kind::EMIT_EXECUTABLE;
+        print_format format  = print_format::PRINT_G15;
+        bool precompute      = false;  // run the program in the compiler and only emit what it prints
+        target_arch arch     = target_arch::ARCH_X86_64_V2;
+        bool fp_contract     = false;  // fuse a multiplication and the addition or subtraction after it into one FMA
+        bool freestanding    = false;  // with `--emit=asm` or `--emit=obj`, start at `_start` instead of libc's
+    };
+}  // namespace mathc
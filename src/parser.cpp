@@ -1,132 +1,167 @@
 #include "parser.hpp"
 #include "ast.hpp"
 #include "scanner.hpp"
-#include <memory>
-#include <variant>
 
 namespace mathc {
-    vector<unique_ptr<ast_node>> expr_parser::parse_program() {
-        vector<unique_ptr<ast_node>> program;
-
-        while (current_.type != token_type::TOKEN_EOF) {
-            if (current_.type == token_type::TOKEN_SEMICOLON) {
-                advance();
-                continue;
-            }
-
-            program.push_back(parse_expression());
+    namespace {
+        constexpr size_t token_type_count = CAST<size_t>(token_type::TOKEN_EOF) + 1;
+
+        constexpr array<binary_operator_info, token_type_count> make_operator_table() {
+            array<binary_operator_info, token_type_count> table {};
+            const auto set = [&table](token_type type, u8 precedence, bool right_associative) {
+                table[CAST<size_t>(type)] = {precedence, right_associative};
+            };
+
+            set(token_type::TOKEN_ADD, 1, false);
+            set(token_type::TOKEN_SUBTRACT, 1, false);
+            set(token_type::TOKEN_MULTIPLY, 2, false);
+            set(token_type::TOKEN_DIVIDE, 2, false);
+            set(token_type::TOKEN_FLOOR_DIV, 2, false);
+            set(token_type::TOKEN_MODULO, 2, false);
+
+            return table;
         }
 
-        return program;
-    }
+        constexpr auto operator_table = make_operator_table();
+    }  // namespace
 
-    unique_ptr<ast_node> expr_parser::parse_expression() {
-        // Check for print statement
-        if (current_.type == token_type::TOKEN_KEYWORD && std::holds_alternative<string>(current_.value)) {
-            string keyword = std::get<string>(current_.value);
-            if (keyword == "print") {
-                return parse_print_statement();
-            }
-        }
-
-        // Otherwise parse as assignment or expression
-        return parse_assignment();
+    binary_operator_info expr_parser::get_operator_info(token_type type) {
+        return operator_table[CAST<size_t>(type)];
     }
 
-    unique_ptr<ast_node> expr_parser::parse_term() {
-        auto left = parse_factor();
+    ast_program expr_parser::parse_program() {
+        // Every token produces at most one node, so this is the only allocation the node array needs
+        program_.reserve(tokens_.size());
 
-        while (current_.type == token_type::TOKEN_MULTIPLY || current_.type == token_type::TOKEN_DIVIDE ||
-               current_.type == token_type::TOKEN_FLOOR_DIV) {
-            token_type op = current_.type;
-            advance();
-            auto right = parse_factor();
-            left       = std::make_unique<ast_binary_op>(std::move(left), op, std::move(right));
+        while (current() != token_type::TOKEN_EOF) {
+            if (current() == token_type::TOKEN_SEMICOLON) {
+                advance();
+                continue;
+            }
+
+            program_.add_statement(parse_expression());
         }
 
-        return left;
+        return std::move(program_);
     }
 
-    unique_ptr<ast_node> expr_parser::parse_factor() {
-        // Handle numbers
-        if (current_.type == token_type::TOKEN_NUMBER && std::holds_alternative<f64>(current_.value)) {
-            auto node = std::make_unique<ast_number>(std::get<f64>(current_.value));
-            advance();
-            return node;
-        }
-
-        // Handle identifiers
-        if (current_.type == token_type::TOKEN_IDENTIFIER && std::holds_alternative<string>(current_.value)) {
-            auto node = std::make_unique<ast_identifier>(std::get<string>(current_.value));
+    bool expr_parser::parse_statement(size_t& pos, ast_ref& root) {
+        pos_ = pos;
+        while (current() == token_type::TOKEN_SEMICOLON) {
             advance();
-            return node;
         }
 
-        // Handle parentheses
-        if (match(token_type::TOKEN_LEFT_PAREN)) {
-            auto node = parse_additive();
-            expect(token_type::TOKEN_RIGHT_PAREN);
-            return node;
+        if (current() == token_type::TOKEN_EOF) {
+            pos = pos_;
+            return false;
         }
 
-        throw parse_error("expected number, identifier, or '('");
+        root = parse_expression();
+        pos  = pos_;
+        return true;
     }
 
-    unique_ptr<ast_node> expr_parser::parse_additive() {
-        auto left = parse_term();
-
-        while (current_.type == token_type::TOKEN_ADD || current_.type == token_type::TOKEN_SUBTRACT) {
-            token_type op = current_.type;
-            advance();
-            auto right = parse_term();
-            left       = std::make_unique<ast_binary_op>(std::move(left), op, std::move(right));
-        }
+    ast_ref expr_parser::parse_expression() {
+        operators_.clear();
+        operands_.clear();
+
+        bool expect_operand   = true;
+        bool expression_start = true;  // 'print' may only open a whole expression
+
+        while (true) {
+            if (expect_operand) {
+                if (expression_start && current() == token_type::TOKEN_KEYWORD &&
+                    tokens_.keyword_at(pos_) == keyword::KW_PRINT) {
+                    advance();  // consume 'print'
+                    expect(token_type::TOKEN_LEFT_PAREN);
+                    operators_.push_back({frame_kind::FRAME_PRINT, token_type::TOKEN_INVALID, 0});
+                    continue;
+                }
+                expression_start = false;
+
+                switch (current()) {
+                    case token_type::TOKEN_NUMBER:
+                        operands_.push_back(program_.add_number(tokens_.number(pos_)));
+                        expect_operand = false;
+                        break;
+                    case token_type::TOKEN_IDENTIFIER:
+                        operands_.push_back(program_.add_identifier(tokens_.symbol(pos_)));
+                        expect_operand = false;
+                        break;
+                    case token_type::TOKEN_LEFT_PAREN:
+                        operators_.push_back({frame_kind::FRAME_PAREN, token_type::TOKEN_INVALID, 0});
+                        break;
+                    default:
+                        error("expected number, identifier, or '('");
+                }
+                advance();
+                continue;
+            }
 
-        return left;
-    }
+            // An operand is complete; a binary operator continues the current expression
+            const token_type type = current();
+            if (const auto info = get_operator_info(type); info.precedence != 0) {
+                reduce_binary(info.right_associative ? info.precedence + 1 : info.precedence);
+                operators_.push_back({frame_kind::FRAME_BINARY, type, info.precedence});
+                advance();
+                expect_operand = true;
+                continue;
+            }
 
-    unique_ptr<ast_node> expr_parser::parse_assignment() {
-        auto left = parse_additive();
+            // Anything else closes the innermost group
+            reduce_binary(0);
+            if (!operators_.empty() && operators_.back().kind == frame_kind::FRAME_PAREN) {
+                expect(token_type::TOKEN_RIGHT_PAREN);
+                operators_.pop_back();
+                continue;
+            }
 
-        // Check if this is an assignment
-        if (current_.type == token_type::TOKEN_ASSIGNMENT) {
-            advance();                        // consume '='
-            auto right = parse_assignment();  // Right associative
+            if (type == token_type::TOKEN_ASSIGNMENT) {
+                advance();  // consume '='; the value is parsed as another (right associative) assignment
+                operators_.push_back({frame_kind::FRAME_ASSIGN, token_type::TOKEN_INVALID, 0});
+                expect_operand = true;
+                continue;
+            }
 
-            // consume semicolon if present
-            if (current_.type == token_type::TOKEN_SEMICOLON) {
-                advance();
+            // End of an assignment chain: the innermost assignment and each enclosing one consume a trailing ';'
+            match(token_type::TOKEN_SEMICOLON);
+            while (!operators_.empty() && operators_.back().kind == frame_kind::FRAME_ASSIGN) {
+                operators_.pop_back();
+                const ast_ref value = operands_.back();
+                operands_.pop_back();
+                operands_.back() = program_.add_assign_op(operands_.back(), value);
+                match(token_type::TOKEN_SEMICOLON);
             }
 
-            return std::make_unique<ast_assign_op>(std::move(left), std::move(right));
-        }
+            // Whatever is left are open print calls, innermost first
+            while (!operators_.empty()) {
+                expect(token_type::TOKEN_RIGHT_PAREN);
+                operators_.pop_back();
+                operands_.back() = program_.add_print_stmt(operands_.back());
+            }
 
-        // consume semicolon if present
-        if (current_.type == token_type::TOKEN_SEMICOLON) {
-            advance();
+            return operands_.back();
         }
-
-        return left;
     }
 
-    unique_ptr<ast_node> expr_parser::parse_print_statement() {
-        advance();  // consume 'print'
-
-        expect(token_type::TOKEN_LEFT_PAREN);
-        auto expr = parse_expression();
-        expect(token_type::TOKEN_RIGHT_PAREN);
+    void expr_parser::reduce_binary(u8 min_precedence) {
+        while (!operators_.empty() && operators_.back().kind == frame_kind::FRAME_BINARY &&
+               operators_.back().precedence >= min_precedence) {
+            const token_type op = operators_.back().op;
+            operators_.pop_back();
 
-        return std::make_unique<ast_print_stmt>(std::move(expr));
+            const ast_ref right = operands_.back();
+            operands_.pop_back();
+            operands_.back() = program_.add_binary_op(operands_.back(), op, right);
+        }
     }
 
     void expr_parser::advance() {
-        try {
-            current_ = scanner_.emit();
-        } catch (const scan_error& e) { throw parse_error(e.what()); }
+        ++pos_;
     }
 
     bool expr_parser::match(token_type type) {
-        if (current_.type == type) {
+        if (current() == type) {
             advance();
             return true;
         }
@@ -135,7 +170,11 @@ namespace mathc {
 
     void expr_parser::expect(token_type type) {
         if (!match(type)) {
-            throw parse_error("expected token type: " + token::token_type_to_str(type));
+            error("expected token type: " + token::token_type_to_str(type));
         }
     }
+
+    void expr_parser::error(const string& message) const {
+        throw parse_error(message + " at " + tokens_.describe(pos_));
+    }
 }  // namespace mathc
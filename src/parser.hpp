@@ -10,26 +10,75 @@ namespace mathc {
         using std::runtime_error::runtime_error;
     };
 
+    /// @brief Binding strength of a binary operator token
+    struct binary_operator_info {
+        u8 precedence;  // 0 means the token is not a binary operator
+        bool right_associative;
+    };
+
+    /// @brief Table-driven precedence-climbing parser.
+    ///
+    /// Grammar:
+    ///   expression := 'print' '(' expression ')' | assignment
+    ///   assignment := binary ('=' assignment)? ';'?
+    ///   binary     := operand (OPERATOR operand)*   -- precedence and associativity from `binary_operator_info`
+    ///   operand    := NUMBER | IDENTIFIER | '(' binary ')'
+    ///
+    /// Operators, parentheses, pending assignments and open print calls are kept on explicit stacks, so nesting depth
+    /// is limited by memory rather than by the native call stack.
     class expr_parser {
     public:
-        explicit expr_parser(token_scanner& scanner) : scanner_(scanner) {
-            advance();
+        explicit expr_parser(const token_stream& tokens) : tokens_(tokens), pos_(0) {}
+
+        /// Continues adding nodes to an existing program
+        expr_parser(const token_stream& tokens, ast_program&& program)
+            : tokens_(tokens), pos_(0), program_(std::move(program)) {}
+
+        ast_program parse_program();
+        ast_ref parse_expression();
+
+        /// Skips ';' separators from token `pos` and parses the next statement. Returns false at EOF; otherwise stores
+        /// the statement in `root` and moves `pos` past it.
+        bool parse_statement(size_t& pos, ast_ref& root);
+
+        ast_program take_program() {
+            return std::move(program_);
         }
 
-        vector<unique_ptr<ast_node>> parse_program();
-        unique_ptr<ast_node> parse_expression();
-        unique_ptr<ast_node> parse_term();
-        unique_ptr<ast_node> parse_factor();
-        unique_ptr<ast_node> parse_additive();
-        unique_ptr<ast_node> parse_assignment();
-        unique_ptr<ast_node> parse_print_statement();
+        [[nodiscard]] static binary_operator_info get_operator_info(token_type type);
 
     private:
-        token_scanner& scanner_;
-        token current_ {};
+        enum class frame_kind : u8 {
+            FRAME_BINARY,  // pending binary operator
+            FRAME_PAREN,   // open '('
+            FRAME_ASSIGN,  // pending '=' whose value is being parsed
+            FRAME_PRINT,   // open 'print('
+        };
+
+        struct frame {
+            frame_kind kind;
+            token_type op;
+            u8 precedence;
+        };
+
+        const token_stream& tokens_;
+        size_t pos_;
+        ast_program program_;
+        vector<frame> operators_;
+        vector<ast_ref> operands_;
+
+        [[nodiscard]] token_type current() const {
+            return tokens_.type(pos_);
+        }
+
+        [[nodiscard]] token_type peek(size_t distance = 1) const {
+            return tokens_.type(pos_ + distance);
+        }
 
+        void reduce_binary(u8 min_precedence);
         void advance();
         bool match(token_type type);
         void expect(token_type type);
+        [[noreturn]] void error(const string& message) const;
     };
 }  // namespace mathc
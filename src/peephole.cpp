@@ -0,0 +1,287 @@
+#include "peephole.hpp"
+
+#include <bit>
+
+namespace mathc {
+    namespace {
+        constexpr u64 one_bits           = 0x3FF0000000000000;
+        constexpr u64 positive_zero_bits = 0x0000000000000000;
+        constexpr u64 negative_zero_bits = 0x8000000000000000;
+
+        bool is(const asm_instruction& instruction, asm_opcode opcode) {
+            return instruction.opcode == opcode;
+        }
+
+        bool is_xmm(const asm_operand& operand) {
+            return operand.kind == operand_kind::OPERAND_XMM;
+        }
+
+        /// xmm or ymm: either names the same register
+        bool is_vector(const asm_operand& operand) {
+            return is_xmm(operand) || operand.kind == operand_kind::OPERAND_YMM;
+        }
+
+        bool is_literal(const asm_operand& operand, u64 bits) {
+            return operand.kind == operand_kind::OPERAND_LITERAL && operand.value == bits;
+        }
+
+        /// `movsd [mem], xmm` where mem is a variable or stack slot
+        bool is_store(const asm_instruction& instruction) {
+            return is(instruction, asm_opcode::OP_MOVSD) && is_xmm(instruction.src()) &&
+                   (instruction.dst().kind == operand_kind::OPERAND_VAR ||
+                    instruction.dst().kind == operand_kind::OPERAND_STACK);
+        }
+
+        /// `movsd xmm, [mem]`
+        bool is_load(const asm_instruction& instruction) {
+            return is(instruction, asm_opcode::OP_MOVSD) && is_xmm(instruction.dst()) && instruction.src().is_memory();
+        }
+
+        /// Writes all of its destination register without reading it and has no other effect
+        bool is_pure_register_write(const asm_instruction& instruction) {
+            if (is_load(instruction)) {
+                return true;
+            }
+            if (is(instruction, asm_opcode::OP_MOVAPD)) {
+                return instruction.dst() != instruction.src();
+            }
+            return is(instruction, asm_opcode::OP_XORPD) && instruction.dst() == instruction.src();
+        }
+
+        /// Whether `operand` is `reg` or a memory operand that does not involve it
+        bool reads(const asm_instruction& instruction, const asm_operand& reg) {
+            if (is(instruction, asm_opcode::OP_XORPD) && instruction.dst() == instruction.src()) {
+                return false;  // Idiom for zero, independent of the old value
+            }
+            for (u8 i = 1; i < instruction.operand_count; ++i) {
+                if (instruction.operands[i] == reg) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool is_identity(const asm_instruction& instruction) {
+            const asm_operand& src = instruction.src();
+            switch (instruction.opcode) {
+                case asm_opcode::OP_MULSD:
+                case asm_opcode::OP_DIVSD:
+                    return is_literal(src, one_bits);
+                case asm_opcode::OP_SUBSD:
+                    return is_literal(src, positive_zero_bits);
+                case asm_opcode::OP_ADDSD:
+                    return is_literal(src, negative_zero_bits);
+                case asm_opcode::OP_MOVAPD:
+                    return instruction.dst() == src;
+                default:
+                    return false;
+            }
+        }
+
+        asm_instruction make_move(const asm_operand& dst, const asm_operand& src) {
+            return {asm_opcode::OP_MOVAPD, 2, {dst, src, {}}};
+        }
+
+        /// Bit i set for each xmm<i> (or ymm<i>) whose value is read before it is overwritten, after each instruction.
+        /// There are no branches, so this is one backward pass; every instruction that is not a plain register write
+        /// counts as reading each register it names.
+        vector<u16> live_registers_after(const instruction_list& instructions) {
+            vector<u16> live_after(instructions.size());
+            u16 live = 0;
+            for (size_t i = instructions.size(); i-- > 0;) {
+                live_after[i]                      = live;
+                const asm_instruction& instruction = instructions[i];
+                if (is(instruction, asm_opcode::OP_COMMENT)) {
+                    continue;
+                }
+                if (is(instruction, asm_opcode::OP_CALL)) {
+                    live = 1;  // Calls take an argument in xmm0 and clobber the rest
+                    continue;
+                }
+                if (is_pure_register_write(instruction)) {
+                    live &= CAST<u16>(~(1u << instruction.dst().index));
+                    if (is_vector(instruction.src()) && reads(instruction, instruction.src())) {
+                        live |= CAST<u16>(1u << instruction.src().index);
+                    }
+                    continue;
+                }
+                for (u8 j = 0; j < instruction.operand_count; ++j) {
+                    if (is_vector(instruction.operands[j])) {
+                        live |= CAST<u16>(1u << instruction.operands[j].index);
+                    }
+                }
+            }
+            return live_after;
+        }
+
+        /// Whether `op t, x` for this opcode can take a register copied to t as a separate first source
+        bool has_three_operand_form(asm_opcode opcode) {
+            switch (opcode) {
+                case asm_opcode::OP_ADDSD:
+                case asm_opcode::OP_SUBSD:
+                case asm_opcode::OP_MULSD:
+                case asm_opcode::OP_DIVSD:
+                case asm_opcode::OP_ADDPD:
+                case asm_opcode::OP_SUBPD:
+                case asm_opcode::OP_MULPD:
+                case asm_opcode::OP_DIVPD:
+                case asm_opcode::OP_ANDPD:
+                case asm_opcode::OP_ANDNPD:
+                case asm_opcode::OP_ORPD:
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    }  // namespace
+
+    size_t peephole_optimizer::run(asm_code& code) {
+        // The input is freed block by block as it is copied, so the two are never both held in full
+        const size_t size = code.instructions.size();
+        instruction_list out;
+        code.instructions.consume_blocks([&](span<const asm_instruction> block) {
+            for (const asm_instruction& instruction : block) {
+                out.push_back(instruction);
+                while (simplify_tail(out)) {}
+            }
+        });
+
+        code.instructions = std::move(out);
+        return size - code.instructions.size();
+    }
+
+    bool peephole_optimizer::simplify_tail(instruction_list& out) {
+        const size_t n = out.size();
+        asm_instruction& last = out[n - 1];
+
+        if (is_identity(last)) {
+            out.pop_back();
+            return true;
+        }
+
+        if (n < 2) {
+            return false;
+        }
+        asm_instruction& prev = out[n - 2];
+
+        // movsd [rsp+k], xmmA; movsd xmmB, [rsp+k]  =>  movapd xmmB, xmmA
+        // A spill slot is reloaded exactly once after each store to it, so once the reload is gone so is the slot
+        if (is_store(prev) && is_load(last) && prev.dst() == last.src() &&
+            prev.dst().kind == operand_kind::OPERAND_STACK) {
+            prev = make_move(last.dst(), prev.src());
+            out.pop_back();
+            return true;
+        }
+
+        // movsd [m], xmmA; movsd xmmB, [m]  =>  movsd [m], xmmA; movapd xmmB, xmmA
+        if (is_store(prev) && is_load(last) && prev.dst() == last.src()) {
+            last = make_move(last.dst(), prev.src());
+            return true;
+        }
+
+        // movsd xmmA, [v]; movsd [v], xmmA  =>  movsd xmmA, [v]
+        if (is_load(prev) && is_store(last) && prev.src() == last.dst() && prev.dst() == last.src()) {
+            out.pop_back();
+            return true;
+        }
+
+        // movsd [v], xmmA; movsd [v], xmmB  =>  movsd [v], xmmB
+        if (is_store(prev) && is_store(last) && prev.dst() == last.dst()) {
+            prev = last;
+            out.pop_back();
+            return true;
+        }
+
+        // movapd xmmB, xmmA; movapd xmmA, xmmB  =>  movapd xmmB, xmmA
+        if (is(prev, asm_opcode::OP_MOVAPD) && is(last, asm_opcode::OP_MOVAPD) && prev.dst() == last.src() &&
+            prev.src() == last.dst()) {
+            out.pop_back();
+            return true;
+        }
+
+        // A register write that the next instruction replaces without reading
+        if (is_pure_register_write(prev) && is_pure_register_write(last) && prev.dst() == last.dst() &&
+            !reads(last, prev.dst())) {
+            prev = last;
+            out.pop_back();
+            return true;
+        }
+
+        return false;
+    }
+
+    size_t peephole_optimizer::contract_multiply_adds(asm_code& code) {
+        instruction_list& instructions = code.instructions;
+        const vector<u16> live_after   = live_registers_after(instructions);
+
+        instruction_list out;
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            const asm_instruction& instruction = instructions[i];
+            if (!is(instruction, asm_opcode::OP_MULSD) || i + 1 == instructions.size()) {
+                out.push_back(instruction);
+                continue;
+            }
+
+            const asm_instruction& next = instructions[i + 1];
+            const bool add              = is(next, asm_opcode::OP_ADDSD);
+            const asm_operand& t        = instruction.dst();
+            const asm_operand& x        = instruction.src();
+            const u16 live              = live_after[i + 1];
+            if (!add && !is(next, asm_opcode::OP_SUBSD)) {
+                out.push_back(instruction);
+            } else if (next.dst() == t && next.src() != t) {
+                // t = t * x ± y. FMA takes one memory operand; if both are, x goes through a register that is free.
+                const asm_operand& y     = next.src();
+                const asm_opcode fma_213 = add ? asm_opcode::OP_VFMADD213SD : asm_opcode::OP_VFMSUB213SD;
+                const asm_opcode fma_132 = add ? asm_opcode::OP_VFMADD132SD : asm_opcode::OP_VFMSUB132SD;
+                const u32 free           = ~(live | 1u << t.index) & 0xFFFF;
+                if (is_xmm(x)) {
+                    out.push_back({fma_213, 3, {t, x, y}});
+                } else if (is_xmm(y)) {
+                    out.push_back({fma_132, 3, {t, y, x}});
+                } else if (free != 0) {
+                    const auto scratch = asm_operand::xmm(CAST<u32>(std::countr_zero(free)));
+                    out.push_back({asm_opcode::OP_MOVSD, 2, {scratch, x, {}}});
+                    out.push_back({fma_213, 3, {t, scratch, y}});
+                } else {
+                    out.push_back(instruction);
+                    continue;
+                }
+                ++i;
+            } else if (next.src() == t && is_xmm(next.dst()) && next.dst() != t && (live & 1u << t.index) == 0) {
+                // r = r ± t * x, when nothing reads the product in t afterwards
+                const asm_operand& r = next.dst();
+                out.push_back({add ? asm_opcode::OP_VFMADD231SD : asm_opcode::OP_VFNMADD231SD, 3, {r, t, x}});
+                ++i;
+            } else {
+                out.push_back(instruction);
+            }
+        }
+
+        const size_t removed = instructions.size() - out.size();
+        instructions         = std::move(out);
+        return removed;
+    }
+
+    void peephole_optimizer::fold_register_copies(asm_code& code) {
+        instruction_list& instructions = code.instructions;
+        size_t out                     = 0;
+        for (size_t i = 0; i < instructions.size(); ++i) {
+            asm_instruction instruction = instructions[i];
+            if (is(instruction, asm_opcode::OP_MOVAPD) && is_vector(instruction.src()) && i + 1 < instructions.size()) {
+                const asm_instruction& next = instructions[i + 1];
+                const asm_operand& t        = instruction.dst();
+                const asm_operand& a        = instruction.src();
+                if (next.operand_count == 2 && next.dst() == t && has_three_operand_form(next.opcode)) {
+                    instruction = {next.opcode, 3, {t, a, next.src() == t ? a : next.src()}};
+                    ++i;
+                } else if (is(next, asm_opcode::OP_ROUNDSD) && next.dst() == t && next.src() == t) {
+                    instruction = {next.opcode, 3, {t, a, next.operands[2]}};
+                    ++i;
+                }
+            }
+            instructions[out++] = instruction;
+        }
+        instructions.truncate(out);
+    }
+}  // namespace mathc
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "asm_instruction.hpp"
+
+namespace mathc {
+    /// @brief Local cleanup of an instruction list before it is rendered.
+    ///
+    /// Instructions are copied to an output list one at a time, and after each one a small set of rewrites is tried on
+    /// the last few instructions of the output until none applies, so a rewrite can expose the next. Rewrites:
+    ///  - a store to a variable followed by a load of it keeps the store but loads with a register move
+    ///  - a spill to a stack slot immediately followed by its reload becomes a register move, or nothing
+    ///  - storing a value back to the variable it was just loaded from is dropped
+    ///  - a register write overwritten by the next instruction without being read is dropped
+    ///  - a variable store overwritten by the next instruction is dropped
+    ///  - moves of a register to itself or straight back are dropped
+    ///  - `x * 1.0`, `x / 1.0`, `x - 0.0` and `x + -0.0` are dropped; they return `x` exactly
+    ///
+    /// Two passes for AVX targets run separately, after it: `contract_multiply_adds` changes results, so it is only
+    /// used when asked for, and `fold_register_copies` produces three-operand instructions only the VEX encoding has.
+    class peephole_optimizer {
+    public:
+        /// Rewrites `code` in place and returns the number of instructions removed
+        static size_t run(asm_code& code);
+
+        /// Fuses `mulsd` with an `addsd` or `subsd` right after it that uses the product into one FMA3 instruction:
+        ///  - `mulsd t, x; addsd t, y` computes `t * x + y` in t; if x and y are both in memory, x is loaded into a
+        ///    register that holds nothing needed
+        ///  - `mulsd t, x; addsd r, t` computes `r + t * x` in r, if the product in t is not used again
+        /// Returns the number of instructions removed.
+        static size_t contract_multiply_adds(asm_code& code);
+
+        /// `movapd t, a; op t, x`  =>  `op t, a, x` (with `x` replaced by `a` if it is `t`), for SSE arithmetic on
+        /// registers written in VEX form
+        static void fold_register_copies(asm_code& code);
+
+    private:
+        static bool simplify_tail(instruction_list& out);
+    };
+}  // namespace mathc
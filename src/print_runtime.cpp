@@ -0,0 +1,80 @@
+#include "print_runtime.hpp"
+
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <unistd.h>
+
+namespace mathc {
+    void print_runtime::format(f64 value, print_format format, string& out) {
+        array<char, 64> buffer {};
+        char* const first = buffer.data();
+        char* const last  = first + buffer.size();
+
+        // std::to_chars is exact like the runtime: with a precision it formats as printf does, without one it finds
+        // the same shortest digits
+        if (format == print_format::PRINT_G15 || !std::isfinite(value) || value == 0.0) {
+            out.append(first, std::to_chars(first, last, value, std::chars_format::general, 15).ptr);
+            out += '\n';
+            return;
+        }
+
+        // Shortest digits as d.ddde±x, laid out like %.17g
+        const char* const end = std::to_chars(first, last, value, std::chars_format::scientific).ptr;
+        const char* p         = first;
+        if (*p == '-') {
+            out += *p++;
+        }
+        string digits;
+        for (; *p != 'e'; ++p) {
+            if (*p != '.') {
+                digits += *p;
+            }
+        }
+        i32 exponent = 0;
+        std::from_chars(p + (p[1] == '+' ? 2 : 1), end, exponent);
+
+        const auto count = CAST<i32>(digits.size());
+        if (exponent < -4 || exponent >= 17) {
+            out += digits[0];
+            if (count > 1) {
+                out += '.';
+                out.append(digits, 1);
+            }
+            const i32 magnitude = std::abs(exponent);
+            out += exponent < 0 ? "e-" : "e+";
+            if (magnitude < 10) {
+                out += '0';
+            }
+            out += std::to_string(magnitude);
+        } else if (exponent >= 0) {
+            for (i32 i = 0; i <= exponent; ++i) {
+                out += i < count ? digits[i] : '0';
+            }
+            if (count > exponent + 1) {
+                out += '.';
+                out.append(digits, exponent + 1);
+            }
+        } else {
+            out += "0.";
+            out.append(-exponent - 1, '0');
+            out += digits;
+        }
+        out += '\n';
+    }
+
+    void print_buffer::flush() {
+        size_t written = 0;
+        while (written < buffer_.size()) {
+            const ssize_t result = write(STDOUT_FILENO, buffer_.data() + written, buffer_.size() - written);
+            if (result < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                break;  // Like the runtime, give up on the rest when stdout is gone
+            }
+            written += CAST<size_t>(result);
+        }
+        buffer_.clear();
+    }
+}  // namespace mathc
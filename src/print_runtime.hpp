@@ -0,0 +1,59 @@
+#pragma once
+
+#include "options.hpp"
+
+namespace mathc {
+    /// @brief Support code linked into every compiled program.
+    ///
+    /// Printing a value is a call to `mathc_print` with the value in xmm0. The runtime formats it into a 64 KiB
+    /// buffer with its own exact double-to-decimal conversion and hands the buffer to write(2) when it fills up and
+    /// when `main` calls `mathc_flush` before returning, so a program makes one system call per few thousand prints
+    /// instead of going through stdio for each one. Both routines follow the SysV calling convention: they preserve
+    /// rbx and clobber every xmm register.
+    ///
+    /// The runtime is C (src/runtime/print_runtime.c), prebuilt into a relocatable object per print format, so building
+    /// a program only links it. It needs neither libc nor libgcc: it makes the write(2) system call itself. Programs
+    /// run in the compiler's process (`--run`) call `format` instead, see `jit_code::bind_print_runtime`.
+    class print_runtime {
+    public:
+        static constexpr const char* print_symbol = "mathc_print";
+        static constexpr const char* flush_symbol = "mathc_flush";
+
+        /// The prebuilt runtime object that formats values as `format` says (src/print_runtime_objects.cpp)
+        static span<const u8> object(print_format format);
+
+        /// Appends the line the runtime prints for `value`, for output produced at compile time
+        static void format(f64 value, print_format format, string& out);
+    };
+
+    /// @brief The print runtime for programs run in the compiler's process: lines are formatted with
+    /// `print_runtime::format` into a 64 KiB buffer that goes to stdout when it fills up and on `flush`
+    class print_buffer {
+    public:
+        explicit print_buffer(print_format format) : format_(format) {
+            buffer_.reserve(capacity);
+        }
+
+        ~print_buffer() {
+            flush();
+        }
+
+        print_buffer(const print_buffer&)            = delete;
+        print_buffer& operator=(const print_buffer&) = delete;
+
+        void print(f64 value) {
+            print_runtime::format(value, format_, buffer_);
+            if (buffer_.size() >= capacity) {
+                flush();
+            }
+        }
+
+        void flush();
+
+    private:
+        static constexpr size_t capacity = 64 * 1024;
+
+        print_format format_;
+        string buffer_;
+    };
+}  // namespace mathc
@@ -0,0 +1,712 @@
+// Generated by src/runtime/build.sh from src/runtime/print_runtime.c; do not edit.
+
+#include "print_runtime.hpp"
+
+namespace mathc {
+    namespace {
+        constexpr u8 runtime_g15[] = {
+            0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x09, 0x00, 0x08, 0x00,
+            0x49, 0x89, 0xf8, 0x48, 0x89, 0xf7, 0x45, 0x8b, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xc9,
+            0x7e, 0x5c, 0x49, 0x63, 0xc1, 0x4c, 0x89, 0xc1, 0x31, 0xf6, 0x4d, 0x8d, 0x14, 0x80, 0x66, 0x90,
+            0x8b, 0x01, 0x48, 0xf7, 0xe7, 0x48, 0x01, 0xf0, 0x48, 0x83, 0xd2, 0x00, 0x89, 0x01, 0x48, 0xc1,
+            0xe8, 0x20, 0x48, 0x83, 0xc1, 0x04, 0x48, 0xc1, 0xe2, 0x20, 0x48, 0x89, 0xd6, 0x48, 0x09, 0xc6,
+            0x4c, 0x39, 0xd1, 0x75, 0xdb, 0x48, 0x85, 0xf6, 0x74, 0x24, 0x41, 0x8d, 0x51, 0x01, 0x48, 0x63,
+            0xc2, 0x41, 0x89, 0x74, 0x80, 0xfc, 0x48, 0x83, 0xc0, 0x01, 0x48, 0xc1, 0xee, 0x20, 0x74, 0x07,
+            0x41, 0x89, 0x74, 0x80, 0xfc, 0x89, 0xc2, 0x41, 0x89, 0x90, 0xc0, 0x00, 0x00, 0x00, 0xc3, 0x90,
+            0x4c, 0x63, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xdb, 0x0f, 0x84, 0xe8, 0x00, 0x00, 0x00,
+            0x85, 0xf6, 0x44, 0x8d, 0x46, 0x1f, 0x89, 0xf0, 0x41, 0x89, 0xf1, 0x44, 0x0f, 0x49, 0xc6, 0xc1,
+            0xf8, 0x1f, 0x45, 0x89, 0xca, 0x41, 0x55, 0xc1, 0xe8, 0x1b, 0x41, 0x54, 0x41, 0x8d, 0x53, 0xff,
+            0x8d, 0x34, 0x06, 0x41, 0xc1, 0xf8, 0x05, 0x55, 0x83, 0xe6, 0x1f, 0x53, 0x43, 0x8d, 0x1c, 0x03,
+            0x29, 0xc6, 0x41, 0x83, 0xe2, 0x1f, 0x75, 0x60, 0x31, 0xed, 0x48, 0x63, 0xc2, 0x45, 0x85, 0xdb,
+            0x0f, 0x8e, 0xc0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xd2, 0x41, 0xbd, 0x20, 0x00, 0x00, 0x00, 0x41,
+            0x0f, 0x95, 0xc4, 0x44, 0x01, 0xc2, 0x41, 0x29, 0xf5, 0x48, 0x63, 0xd2, 0x4c, 0x29, 0xda, 0x4c,
+            0x8d, 0x1c, 0x97, 0xeb, 0x23, 0x0f, 0x1f, 0x00, 0x8b, 0x74, 0x87, 0xfc, 0x44, 0x89, 0xe9, 0xd3,
+            0xee, 0x8b, 0x14, 0x87, 0x44, 0x89, 0xd1, 0xd3, 0xe2, 0x09, 0xf2, 0x41, 0x89, 0x54, 0x83, 0x04,
+            0x48, 0x83, 0xe8, 0x01, 0x85, 0xc0, 0x78, 0x28, 0x85, 0xc0, 0x7e, 0x05, 0x45, 0x84, 0xe4, 0x75,
+            0xd7, 0x31, 0xf6, 0xeb, 0xdc, 0x0f, 0x1f, 0x00, 0x48, 0x63, 0xc2, 0xb9, 0x20, 0x00, 0x00, 0x00,
+            0x8b, 0x2c, 0x87, 0x29, 0xf1, 0xd3, 0xed, 0x85, 0xd2, 0x79, 0x9b, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x41, 0x83, 0xf9, 0x1f, 0x7e, 0x1a, 0x31, 0xc0, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xc7, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc0, 0x01, 0x41, 0x39, 0xc0, 0x7f, 0xf0,
+            0x85, 0xed, 0x75, 0x1c, 0x89, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d,
+            0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+            0x8d, 0x43, 0x01, 0x48, 0x63, 0xdb, 0x89, 0x87, 0xc0, 0x00, 0x00, 0x00, 0x89, 0x2c, 0x9f, 0x5b,
+            0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x41, 0x83, 0xf9, 0x1f, 0x7f, 0xaa, 0xeb, 0xc6, 0x66, 0x90,
+            0x41, 0x57, 0x41, 0x89, 0xf0, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x89, 0xd3, 0x48,
+            0x81, 0xec, 0x88, 0x02, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x83, 0xfa, 0x1b, 0x0f, 0x87,
+            0x9c, 0x00, 0x00, 0x00, 0x44, 0x8d, 0x0c, 0x33, 0x4c, 0x8d, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x48,
+            0x63, 0xd2, 0x48, 0x89, 0xf8, 0x49, 0xf7, 0x64, 0xd5, 0x00, 0x41, 0x83, 0xf9, 0x3f, 0x0f, 0x86,
+            0xe4, 0x01, 0x00, 0x00, 0x41, 0x83, 0xf9, 0x81, 0x0f, 0x82, 0x82, 0x00, 0x00, 0x00, 0x41, 0x83,
+            0xf9, 0xc1, 0x0f, 0x8c, 0x6b, 0x05, 0x00, 0x00, 0x45, 0x89, 0xca, 0x48, 0x89, 0xd6, 0x41, 0xf7,
+            0xda, 0x44, 0x89, 0xd1, 0x48, 0xd3, 0xee, 0x48, 0x85, 0xf6, 0x75, 0x64, 0x44, 0x89, 0xc9, 0xbf,
+            0x01, 0x00, 0x00, 0x00, 0x48, 0xc7, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xd1, 0x48, 0xd3, 0xe7,
+            0x44, 0x89, 0xd1, 0x48, 0xd3, 0xe6, 0x48, 0x89, 0xf1, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x48, 0xf7,
+            0xd1, 0x48, 0x21, 0xc1, 0x48, 0x39, 0xf9, 0x72, 0x09, 0x31, 0xf6, 0x48, 0x39, 0xcf, 0x40, 0x0f,
+            0x92, 0xc6, 0x41, 0x8d, 0x49, 0x40, 0x48, 0xd3, 0xe2, 0x44, 0x89, 0xd1, 0x48, 0xd3, 0xe8, 0x48,
+            0x89, 0xc5, 0x48, 0x09, 0xd5, 0xe9, 0xf4, 0x03, 0x00, 0x00, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x83, 0xfa, 0xe5, 0x0f, 0x83, 0xed, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x2d, 0x00, 0x00, 0x00, 0x00,
+            0xc7, 0x84, 0x24, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85, 0xff, 0x74, 0x21,
+            0x48, 0x89, 0xf8, 0x89, 0x7c, 0x24, 0x10, 0x48, 0xc1, 0xe8, 0x20, 0x0f, 0x84, 0x50, 0x05, 0x00,
+            0x00, 0x89, 0x44, 0x24, 0x14, 0xb8, 0x02, 0x00, 0x00, 0x00, 0x89, 0x84, 0x24, 0xd0, 0x00, 0x00,
+            0x00, 0xc7, 0x84, 0x24, 0xa0, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x44, 0x89, 0xc6, 0xc7,
+            0x84, 0x24, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xf7, 0xde, 0x41, 0x0f, 0x48, 0xf0,
+            0x45, 0x85, 0xc0, 0x0f, 0x8e, 0xf7, 0x03, 0x00, 0x00, 0x4c, 0x8d, 0x7c, 0x24, 0x10, 0x4c, 0x89,
+            0xff, 0xe8, 0xaa, 0xfd, 0xff, 0xff, 0x89, 0xdd, 0x4c, 0x8d, 0x9c, 0x24, 0xe0, 0x00, 0x00, 0x00,
+            0xf7, 0xdd, 0x0f, 0x48, 0xeb, 0x85, 0xdb, 0x4d, 0x0f, 0x4f, 0xdf, 0x41, 0x89, 0xec, 0x83, 0xfd,
+            0x1b, 0x7e, 0x22, 0x48, 0xbb, 0x9d, 0x07, 0x10, 0xfa, 0x93, 0xc7, 0x65, 0x67, 0x0f, 0x1f, 0x00,
+            0x48, 0x89, 0xde, 0x4c, 0x89, 0xdf, 0x41, 0x83, 0xec, 0x1b, 0xe8, 0x01, 0xfd, 0xff, 0xff, 0x41,
+            0x83, 0xfc, 0x1b, 0x7f, 0xeb, 0x49, 0x63, 0xc4, 0x4c, 0x89, 0xdf, 0x49, 0x8b, 0x74, 0xc5, 0x00,
+            0xe8, 0xeb, 0xfc, 0xff, 0xff, 0x89, 0xee, 0x4c, 0x89, 0xdf, 0xe8, 0x51, 0xfd, 0xff, 0xff, 0x8b,
+            0x9c, 0x24, 0xd0, 0x00, 0x00, 0x00, 0x85, 0xdb, 0x0f, 0x85, 0xc2, 0x00, 0x00, 0x00, 0x44, 0x8b,
+            0xa4, 0x24, 0xa0, 0x01, 0x00, 0x00, 0x45, 0x85, 0xe4, 0x0f, 0x84, 0xb0, 0x03, 0x00, 0x00, 0x31,
+            0xc0, 0xe9, 0x7f, 0x03, 0x00, 0x00, 0x8d, 0x04, 0x32, 0x83, 0xf8, 0x3f, 0x0f, 0x87, 0xaa, 0x03,
+            0x00, 0x00, 0x85, 0xc0, 0x0f, 0x84, 0x6d, 0x04, 0x00, 0x00, 0xb9, 0x40, 0x00, 0x00, 0x00, 0x48,
+            0x89, 0xfa, 0x48, 0x89, 0xfe, 0x29, 0xc1, 0x48, 0xd3, 0xea, 0x89, 0xc1, 0x48, 0xd3, 0xe6, 0x48,
+            0x89, 0xf0, 0x89, 0xd9, 0x4c, 0x8d, 0x2d, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xd9, 0x48, 0x63, 0xc9,
+            0x49, 0x8b, 0x4c, 0xcd, 0x00, 0x48, 0x39, 0xca, 0x0f, 0x83, 0xd2, 0xfe, 0xff, 0xff, 0x48, 0xf7,
+            0xf1, 0x48, 0x29, 0xd1, 0x48, 0x89, 0xc5, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x48, 0x39, 0xca, 0x0f,
+            0x82, 0x99, 0x02, 0x00, 0x00, 0x31, 0xf6, 0x48, 0x39, 0xd1, 0x40, 0x0f, 0x92, 0xc6, 0xe9, 0x8b,
+            0x02, 0x00, 0x00, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x85, 0xd2, 0x0f, 0x85, 0x9f, 0xfe, 0xff,
+            0xff, 0x45, 0x85, 0xc9, 0x74, 0x17, 0xb9, 0x40, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc2, 0x44, 0x29,
+            0xc9, 0x48, 0xd3, 0xea, 0x48, 0x85, 0xd2, 0x0f, 0x85, 0x83, 0xfe, 0xff, 0xff, 0x44, 0x89, 0xc9,
+            0xbe, 0xff, 0xff, 0xff, 0xff, 0x48, 0xd3, 0xe0, 0x48, 0x89, 0xc5, 0xe9, 0x4e, 0x02, 0x00, 0x00,
+            0x44, 0x8d, 0x4b, 0xff, 0x89, 0xd8, 0x4d, 0x63, 0xc9, 0x42, 0x0f, 0xbd, 0x4c, 0x8c, 0x10, 0xc1,
+            0xe0, 0x05, 0x83, 0xf1, 0x1f, 0x29, 0xc8, 0x8b, 0x8c, 0x24, 0xa0, 0x01, 0x00, 0x00, 0x41, 0x89,
+            0xc4, 0x89, 0x4c, 0x24, 0x04, 0x85, 0xc9, 0x0f, 0x85, 0xa5, 0x02, 0x00, 0x00, 0x45, 0x85, 0xe4,
+            0x0f, 0x88, 0x57, 0x03, 0x00, 0x00, 0x31, 0xed, 0x48, 0x8d, 0xbc, 0x24, 0xb0, 0x01, 0x00, 0x00,
+            0x41, 0xbd, 0x01, 0x00, 0x00, 0x00, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x66, 0x0f, 0x6f, 0x84, 0x24, 0xe0, 0x00, 0x00, 0x00, 0x8b, 0x84, 0x24, 0xa0, 0x01, 0x00, 0x00,
+            0x44, 0x89, 0xe6, 0x66, 0x0f, 0x6f, 0x8c, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x94,
+            0x24, 0x00, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x9c, 0x24, 0x10, 0x01, 0x00, 0x00, 0x89, 0x84,
+            0x24, 0x70, 0x02, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0xa4, 0x24, 0x20, 0x01, 0x00, 0x00, 0x66, 0x0f,
+            0x6f, 0xac, 0x24, 0x30, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x84, 0x24, 0xb0, 0x01, 0x00, 0x00, 0x66,
+            0x0f, 0x6f, 0xb4, 0x24, 0x40, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x8c, 0x24, 0xc0, 0x01, 0x00, 0x00,
+            0x66, 0x0f, 0x6f, 0xbc, 0x24, 0x50, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x84, 0x24, 0x60, 0x01,
+            0x00, 0x00, 0x0f, 0x29, 0x94, 0x24, 0xd0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x8c, 0x24, 0x70,
+            0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x94, 0x24, 0x80, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x9c, 0x24,
+            0xe0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x9c, 0x24, 0x90, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xa4,
+            0x24, 0xf0, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xac, 0x24, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xb4,
+            0x24, 0x10, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xbc, 0x24, 0x20, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x84,
+            0x24, 0x30, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x8c, 0x24, 0x40, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x94,
+            0x24, 0x50, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x9c, 0x24, 0x60, 0x02, 0x00, 0x00, 0xe8, 0x4e, 0xfb,
+            0xff, 0xff, 0x44, 0x8b, 0x94, 0x24, 0x70, 0x02, 0x00, 0x00, 0x41, 0x39, 0xda, 0x0f, 0x84, 0xad,
+            0x00, 0x00, 0x00, 0x0f, 0x8f, 0x90, 0x00, 0x00, 0x00, 0x44, 0x8d, 0x4b, 0xff, 0x85, 0xdb, 0x7e,
+            0x7c, 0x48, 0x63, 0xf3, 0x31, 0xd2, 0x45, 0x31, 0xc0, 0xeb, 0x08, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x48, 0x89, 0xc2, 0x41, 0x8b, 0x04, 0x97, 0x45, 0x31, 0xdb, 0x41, 0x39, 0xd2, 0x7e, 0x04, 0x44,
+            0x8b, 0x1c, 0x97, 0x4c, 0x29, 0xd8, 0x4c, 0x29, 0xc0, 0x41, 0x89, 0x04, 0x97, 0x48, 0xc1, 0xe8,
+            0x3f, 0x49, 0x89, 0xc0, 0x48, 0x8d, 0x42, 0x01, 0x48, 0x39, 0xf0, 0x75, 0xd3, 0x49, 0x63, 0xc1,
+            0x48, 0x83, 0xea, 0x01, 0x45, 0x89, 0xc9, 0x31, 0xf6, 0x4c, 0x29, 0xca, 0xeb, 0x14, 0x66, 0x90,
+            0x48, 0x83, 0xe8, 0x01, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x48, 0x39, 0xc2, 0x0f, 0x84, 0xbe, 0x00,
+            0x00, 0x00, 0x41, 0x8b, 0x0c, 0x87, 0x45, 0x89, 0xf0, 0x41, 0x89, 0xc6, 0x85, 0xc9, 0x74, 0xe0,
+            0x40, 0x84, 0xf6, 0x74, 0x08, 0x44, 0x89, 0x84, 0x24, 0xd0, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xe8,
+            0x44, 0x89, 0xe1, 0x48, 0xd3, 0xe0, 0x48, 0x09, 0xc5, 0x41, 0x83, 0xec, 0x01, 0x72, 0x49, 0x8b,
+            0x9c, 0x24, 0xd0, 0x00, 0x00, 0x00, 0xe9, 0x65, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x41, 0x89, 0xd9, 0x41, 0x83, 0xe9, 0x01, 0x78, 0xd4, 0x49, 0x63, 0xc1, 0xeb, 0x0e, 0x66, 0x90,
+            0x48, 0x83, 0xe8, 0x01, 0x85, 0xc0, 0x0f, 0x88, 0x45, 0xff, 0xff, 0xff, 0x8b, 0x0c, 0x87, 0x41,
+            0x39, 0x0c, 0x87, 0x74, 0xeb, 0x0f, 0x83, 0x36, 0xff, 0xff, 0xff, 0x41, 0x83, 0xec, 0x01, 0x73,
+            0xbe, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xff,
+            0xe8, 0x4b, 0xfa, 0xff, 0xff, 0x8b, 0x44, 0x24, 0x04, 0x3b, 0x84, 0x24, 0xd0, 0x00, 0x00, 0x00,
+            0x74, 0x3e, 0x40, 0x0f, 0x9e, 0xc6, 0x40, 0x0f, 0xb6, 0xf6, 0x8d, 0x74, 0x36, 0xff, 0x48, 0x8b,
+            0x44, 0x24, 0x08, 0x89, 0x30, 0x48, 0x81, 0xc4, 0x88, 0x02, 0x00, 0x00, 0x48, 0x89, 0xe8, 0x5b,
+            0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x44, 0x89, 0xb4, 0x24, 0xd0, 0x00, 0x00, 0x00, 0xe9, 0x50, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x00,
+            0x8b, 0x5c, 0x24, 0x04, 0x83, 0xeb, 0x01, 0x0f, 0x88, 0xf9, 0x00, 0x00, 0x00, 0x48, 0x63, 0xc3,
+            0x4c, 0x8d, 0x9c, 0x24, 0xe0, 0x00, 0x00, 0x00, 0xeb, 0x12, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x48, 0x83, 0xe8, 0x01, 0x85, 0xc0, 0x0f, 0x88, 0xda, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x1c, 0x83,
+            0x41, 0x39, 0x1c, 0x87, 0x74, 0xea, 0x19, 0xf6, 0x83, 0xce, 0x01, 0xeb, 0x91, 0x0f, 0x1f, 0x00,
+            0x48, 0x8d, 0xbc, 0x24, 0xe0, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x7c, 0x24, 0x10, 0xe9, 0xff, 0xfb,
+            0xff, 0xff, 0x41, 0x89, 0xcc, 0x41, 0x8d, 0x74, 0x24, 0xff, 0x44, 0x89, 0x64, 0x24, 0x04, 0x48,
+            0x63, 0xf6, 0x0f, 0xbd, 0xbc, 0xb4, 0xe0, 0x00, 0x00, 0x00, 0x44, 0x89, 0xe6, 0xc1, 0xe6, 0x05,
+            0x83, 0xf7, 0x1f, 0x29, 0xfe, 0x29, 0xf0, 0x41, 0x89, 0xc4, 0xe9, 0x2e, 0xfd, 0xff, 0xff, 0xc7,
+            0x44, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x2a, 0xfd, 0xff, 0xff, 0x83, 0xf8, 0xc1, 0x0f,
+            0x82, 0x54, 0xfb, 0xff, 0xff, 0xf7, 0xdb, 0x48, 0x8d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x48, 0x63,
+            0xd3, 0x48, 0x8b, 0x14, 0xd1, 0x8d, 0x48, 0x40, 0x48, 0x89, 0xd3, 0x48, 0xd3, 0xeb, 0x48, 0x85,
+            0xdb, 0x75, 0x61, 0xf7, 0xd8, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x89, 0xc1, 0x48, 0x89, 0xf8, 0x48,
+            0xd3, 0xe2, 0x48, 0x89, 0xd1, 0x31, 0xd2, 0x48, 0xf7, 0xf1, 0x48, 0x01, 0xd2, 0x48, 0x39, 0xca,
+            0x72, 0x09, 0x31, 0xf6, 0x48, 0x39, 0xd1, 0x40, 0x0f, 0x92, 0xc6, 0x48, 0x89, 0xc5, 0xe9, 0xeb,
+            0xfe, 0xff, 0xff, 0x41, 0x83, 0xf9, 0xc0, 0x75, 0x37, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x48, 0x85,
+            0xc0, 0x78, 0x78, 0xb9, 0xc0, 0xff, 0xff, 0xff, 0x44, 0x29, 0xc9, 0x48, 0xd3, 0xea, 0x48, 0x89,
+            0xd5, 0xe9, 0xc8, 0xfe, 0xff, 0xff, 0x31, 0xf6, 0xe9, 0xc1, 0xfe, 0xff, 0xff, 0x31, 0xed, 0xe9,
+            0x94, 0xfe, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x31, 0xed, 0xe9, 0xae, 0xfe, 0xff, 0xff,
+            0xb9, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0xc7, 0xc6, 0xff, 0xff, 0xff,
+            0xff, 0x44, 0x29, 0xc9, 0x48, 0xd3, 0xe7, 0xb9, 0xc0, 0xff, 0xff, 0xff, 0x44, 0x29, 0xc9, 0x48,
+            0xd3, 0xe6, 0x48, 0x89, 0xf1, 0x48, 0xf7, 0xd1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xf9, 0x74, 0x32,
+            0x19, 0xf6, 0x83, 0xce, 0x01, 0xeb, 0x9c, 0x48, 0x89, 0xf8, 0x31, 0xd2, 0xe9, 0xa1, 0xfb, 0xff,
+            0xff, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xe9, 0xaf, 0xfa, 0xff, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00,
+            0x31, 0xf6, 0x48, 0xc1, 0xe1, 0x3f, 0x48, 0x39, 0xc1, 0x40, 0x0f, 0x92, 0xc6, 0xe9, 0x71, 0xff,
+            0xff, 0xff, 0x31, 0xf6, 0x48, 0x85, 0xc0, 0x40, 0x0f, 0x95, 0xc6, 0xe9, 0x63, 0xff, 0xff, 0xff,
+            0x48, 0x8b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85, 0xd2, 0x74, 0x2f, 0x45, 0x31, 0xc0, 0x4c,
+            0x8d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x4b, 0x8d, 0x34, 0x01, 0x4c,
+            0x29, 0xc2, 0x48, 0x89, 0xf8, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x78, 0x24, 0x49, 0x01, 0xc0, 0x48,
+            0x8b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x49, 0x39, 0xd0, 0x72, 0xe0, 0x48, 0xc7, 0x05, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0x83, 0xf8, 0xfc, 0x74, 0xd9, 0x48, 0xc7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00,
+            0x41, 0x57, 0x4c, 0x8d, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x66, 0x49, 0x0f, 0x7e, 0xc1, 0x41, 0x56,
+            0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48, 0x83, 0xec, 0x38, 0x48, 0x8b, 0x15, 0x00, 0x00, 0x00,
+            0x00, 0x4d, 0x8d, 0x34, 0x17, 0x48, 0x81, 0xfa, 0xe0, 0xff, 0x00, 0x00, 0x0f, 0x87, 0xfe, 0x01,
+            0x00, 0x00, 0x48, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x00, 0x4c, 0x89, 0xc8, 0x4c,
+            0x21, 0xcf, 0x48, 0xc1, 0xe8, 0x34, 0x48, 0x89, 0xfd, 0x25, 0xff, 0x07, 0x00, 0x00, 0x4d, 0x85,
+            0xc9, 0x79, 0x08, 0x41, 0xc6, 0x06, 0x2d, 0x49, 0x83, 0xc6, 0x01, 0x3d, 0xff, 0x07, 0x00, 0x00,
+            0x0f, 0x84, 0x2a, 0x03, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x85, 0x22, 0x02, 0x00, 0x00, 0x48, 0x85,
+            0xed, 0x75, 0x2d, 0x41, 0xc6, 0x06, 0x30, 0x49, 0x8d, 0x46, 0x01, 0xc6, 0x00, 0x0a, 0x48, 0x83,
+            0xc0, 0x01, 0x4c, 0x29, 0xf8, 0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x38,
+            0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x85, 0xc0, 0x0f, 0x85, 0xe8, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x0c, 0xce, 0xfb, 0xff, 0xff,
+            0xbb, 0x0d, 0xfc, 0xff, 0xff, 0x48, 0x0f, 0xbd, 0xc5, 0x4c, 0x8d, 0x6c, 0x24, 0x10, 0x41, 0xbc,
+            0x0e, 0x00, 0x00, 0x00, 0x48, 0x83, 0xf0, 0x3f, 0x29, 0xc3, 0x69, 0xdb, 0x41, 0x34, 0x01, 0x00,
+            0xc1, 0xfb, 0x12, 0x8b, 0x74, 0x24, 0x0c, 0x44, 0x89, 0xe2, 0x4c, 0x89, 0xe9, 0x48, 0x89, 0xef,
+            0x29, 0xda, 0xe8, 0x39, 0xf8, 0xff, 0xff, 0x48, 0x89, 0xc1, 0x48, 0xb8, 0xff, 0x7f, 0xc6, 0xa4,
+            0x7e, 0x8d, 0x03, 0x00, 0x48, 0x39, 0xc8, 0x0f, 0x82, 0x2b, 0x01, 0x00, 0x00, 0x48, 0xb8, 0xff,
+            0x3f, 0x7a, 0x10, 0xf3, 0x5a, 0x00, 0x00, 0x48, 0x39, 0xc8, 0x0f, 0x83, 0xa0, 0x01, 0x00, 0x00,
+            0x8b, 0x44, 0x24, 0x10, 0x85, 0xc0, 0x0f, 0x8e, 0x5c, 0x02, 0x00, 0x00, 0x48, 0xb8, 0x00, 0x80,
+            0xc6, 0xa4, 0x7e, 0x8d, 0x03, 0x00, 0x48, 0x83, 0xc1, 0x01, 0x48, 0x39, 0xc1, 0x75, 0x0d, 0x48,
+            0xb9, 0x00, 0x40, 0x7a, 0x10, 0xf3, 0x5a, 0x00, 0x00, 0x83, 0xc3, 0x01, 0x48, 0xbf, 0xcd, 0xcc,
+            0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x48, 0x8d, 0x74, 0x24, 0x1e, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x48, 0x89, 0xc8, 0x48, 0xf7, 0xe7, 0x48, 0xc1, 0xea, 0x03, 0x48, 0x8d, 0x04, 0x92, 0x48, 0x01,
+            0xc0, 0x48, 0x29, 0xc1, 0x48, 0x89, 0xf0, 0x48, 0x83, 0xee, 0x01, 0x83, 0xc1, 0x30, 0x88, 0x4e,
+            0x01, 0x48, 0x89, 0xd1, 0x49, 0x39, 0xc5, 0x75, 0xd7, 0xb8, 0x0f, 0x00, 0x00, 0x00, 0xeb, 0x13,
+            0x41, 0x80, 0x7c, 0x05, 0xff, 0x30, 0x48, 0x8d, 0x50, 0xff, 0x0f, 0x85, 0x30, 0x01, 0x00, 0x00,
+            0x48, 0x89, 0xd0, 0x48, 0x83, 0xf8, 0x01, 0x75, 0xe7, 0x8d, 0x43, 0x04, 0xbe, 0x01, 0x00, 0x00,
+            0x00, 0x83, 0xf8, 0x12, 0x0f, 0x87, 0x6e, 0x02, 0x00, 0x00, 0x85, 0xdb, 0x0f, 0x88, 0x0e, 0x02,
+            0x00, 0x00, 0x89, 0xdf, 0x31, 0xd2, 0x48, 0x8d, 0x47, 0x01, 0xeb, 0x07, 0x0f, 0x1f, 0x40, 0x00,
+            0x48, 0x89, 0xca, 0xb9, 0x30, 0x00, 0x00, 0x00, 0x39, 0xd6, 0x7e, 0x06, 0x41, 0x0f, 0xb6, 0x4c,
+            0x15, 0x00, 0x41, 0x88, 0x0c, 0x16, 0x48, 0x8d, 0x4a, 0x01, 0x48, 0x39, 0xd7, 0x75, 0xe1, 0x8d,
+            0x53, 0x01, 0x4c, 0x01, 0xf0, 0x39, 0xf2, 0x0f, 0x8d, 0x8e, 0xfe, 0xff, 0xff, 0x4c, 0x01, 0xf7,
+            0xc6, 0x00, 0x2e, 0x48, 0x63, 0xc2, 0x48, 0x63, 0xd3, 0x48, 0x89, 0xf9, 0x48, 0x29, 0xd1, 0x90,
+            0x41, 0x0f, 0xb6, 0x54, 0x05, 0x00, 0x88, 0x54, 0x01, 0x01, 0x48, 0x83, 0xc0, 0x01, 0x39, 0xc6,
+            0x7f, 0xee, 0x29, 0xde, 0x8d, 0x46, 0xfe, 0x48, 0x8d, 0x44, 0x07, 0x03, 0xe9, 0x5a, 0xfe, 0xff,
+            0xff, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x83, 0xc3, 0x01, 0xe9, 0xa3, 0xfe, 0xff, 0xff,
+            0x45, 0x31, 0xc0, 0x4c, 0x8d, 0x3d, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x4b,
+            0x8d, 0x34, 0x07, 0x4c, 0x29, 0xc2, 0x48, 0x89, 0xf8, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x78, 0x30,
+            0x49, 0x01, 0xc0, 0x48, 0x8b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x49, 0x39, 0xd0, 0x72, 0xe0, 0x90,
+            0x48, 0xc7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x35, 0x00, 0x00,
+            0x00, 0x00, 0xe9, 0xbb, 0xfd, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0x83, 0xf8, 0xfc, 0x75, 0xda, 0xeb, 0xcb, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x8d, 0x98, 0xcd, 0xfb, 0xff, 0xff, 0x48, 0x0f, 0xba, 0xed, 0x34, 0x89, 0x5c, 0x24, 0x0c, 0x8d,
+            0x98, 0x0c, 0xfc, 0xff, 0xff, 0xe9, 0x0b, 0xfe, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x83, 0xeb, 0x01, 0xe9, 0x1b, 0xfe, 0xff, 0xff, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x8d, 0x53, 0x04, 0x89, 0xc6, 0x83, 0xfa, 0x12, 0x0f, 0x86, 0xdc, 0xfe, 0xff, 0xff, 0x0f, 0xb6,
+            0x54, 0x24, 0x10, 0x41, 0x88, 0x16, 0x83, 0xf8, 0x01, 0x0f, 0x84, 0x41, 0x01, 0x00, 0x00, 0x41,
+            0xc6, 0x46, 0x01, 0x2e, 0xba, 0x01, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+            0x41, 0x0f, 0xb6, 0x4c, 0x15, 0x00, 0x41, 0x88, 0x4c, 0x16, 0x01, 0x48, 0x83, 0xc2, 0x01, 0x48,
+            0x39, 0xc2, 0x75, 0xec, 0x8d, 0x4e, 0x01, 0x4c, 0x01, 0xf1, 0x89, 0xd8, 0x89, 0xda, 0xc6, 0x01,
+            0x65, 0x48, 0x8d, 0x71, 0x02, 0xc1, 0xf8, 0x1f, 0x83, 0xe0, 0x02, 0x83, 0xc0, 0x2b, 0xf7, 0xda,
+            0x0f, 0x48, 0xd3, 0x88, 0x41, 0x01, 0x83, 0xfa, 0x63, 0x7e, 0x1d, 0x89, 0xd0, 0x48, 0x8d, 0x71,
+            0x03, 0x48, 0x69, 0xc0, 0x1f, 0x85, 0xeb, 0x51, 0x48, 0xc1, 0xe8, 0x25, 0x8d, 0x78, 0x30, 0x6b,
+            0xc0, 0x64, 0x40, 0x88, 0x79, 0x02, 0x29, 0xc2, 0x89, 0xd1, 0xb8, 0xcd, 0xcc, 0xcc, 0xcc, 0x48,
+            0x0f, 0xaf, 0xc8, 0x48, 0xc1, 0xe9, 0x23, 0x8d, 0x41, 0x30, 0x8d, 0x0c, 0x89, 0x01, 0xc9, 0x88,
+            0x06, 0x48, 0x8d, 0x46, 0x02, 0x29, 0xca, 0x83, 0xc2, 0x30, 0x88, 0x56, 0x01, 0xe9, 0x09, 0xfd,
+            0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x0f, 0x85, 0xbe, 0xfd, 0xff, 0xff, 0xf6, 0xc1,
+            0x01, 0x0f, 0x84, 0xb5, 0xfd, 0xff, 0xff, 0xe9, 0x90, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00,
+            0x48, 0x8d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85, 0xed, 0x48, 0x8d, 0x05, 0x00, 0x00, 0x00,
+            0x00, 0x48, 0x0f, 0x45, 0xc2, 0x0f, 0xb7, 0x10, 0x0f, 0xb6, 0x40, 0x02, 0x66, 0x41, 0x89, 0x16,
+            0x41, 0x88, 0x46, 0x02, 0x49, 0x8d, 0x46, 0x03, 0xe9, 0xbe, 0xfc, 0xff, 0xff, 0x0f, 0x1f, 0x00,
+            0x0f, 0xb7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x49, 0x8d, 0x56, 0x02, 0x66, 0x41, 0x89, 0x06, 0x48,
+            0x89, 0xd0, 0x83, 0xfb, 0xff, 0x74, 0x19, 0xb8, 0xfe, 0xff, 0xff, 0xff, 0x29, 0xd8, 0x49, 0x8d,
+            0x44, 0x06, 0x03, 0x48, 0x83, 0xc2, 0x01, 0xc6, 0x42, 0xff, 0x30, 0x48, 0x39, 0xc2, 0x75, 0xf3,
+            0x48, 0x63, 0xfe, 0x31, 0xd2, 0x0f, 0x1f, 0x00, 0x41, 0x0f, 0xb6, 0x4c, 0x15, 0x00, 0x88, 0x0c,
+            0x10, 0x48, 0x83, 0xc2, 0x01, 0x48, 0x39, 0xd7, 0x75, 0xee, 0x89, 0xf6, 0x48, 0x01, 0xf0, 0xe9,
+            0x67, 0xfc, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 0x0f, 0xb6, 0x44, 0x24, 0x10, 0x41, 0x88, 0x06,
+            0x49, 0x8d, 0x4e, 0x01, 0xe9, 0xe1, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x6e, 0x61, 0x6e, 0x00, 0x69, 0x6e, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x71, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x09, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xe1, 0xf5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xcd, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xf9, 0x02, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x0e, 0xe9, 0x02, 0x00, 0x00, 0x00, 0x00,
+            0x51, 0x4a, 0x8d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x95, 0x73, 0xc2, 0x48, 0x00, 0x00, 0x00, 0x00,
+            0xe9, 0x41, 0xcc, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x49, 0xfd, 0x1a, 0x07, 0x00, 0x00, 0x00,
+            0xc1, 0x6f, 0xf2, 0x86, 0x23, 0x00, 0x00, 0x00, 0xc5, 0x2e, 0xbc, 0xa2, 0xb1, 0x00, 0x00, 0x00,
+            0xd9, 0xe9, 0xac, 0x2d, 0x78, 0x03, 0x00, 0x00, 0x3d, 0x91, 0x60, 0xe4, 0x58, 0x11, 0x00, 0x00,
+            0x31, 0xd6, 0xe2, 0x75, 0xbc, 0x56, 0x00, 0x00, 0xf5, 0x2e, 0x6e, 0x4d, 0xae, 0xb1, 0x01, 0x00,
+            0xc9, 0xea, 0x26, 0x83, 0x67, 0x78, 0x08, 0x00, 0xed, 0x95, 0xc2, 0x8f, 0x05, 0x5a, 0x2a, 0x00,
+            0xa1, 0xed, 0xcc, 0xce, 0x1b, 0xc2, 0xd3, 0x00, 0x25, 0xa4, 0x00, 0x0a, 0x8b, 0xca, 0x22, 0x04,
+            0xb9, 0x34, 0x03, 0x32, 0xb7, 0xf4, 0xad, 0x14, 0x9d, 0x07, 0x10, 0xfa, 0x93, 0xc7, 0x65, 0x67,
+            0x30, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+            0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x10, 0x00, 0x00, 0x00, 0x12, 0x02, 0x01, 0x00, 0x70, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x29, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x12, 0x02, 0x01, 0x00,
+            0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x2e, 0x4c, 0x43, 0x30, 0x00, 0x2e, 0x4c, 0x43, 0x31, 0x00, 0x2e, 0x4c, 0x43, 0x32, 0x00,
+            0x6d, 0x61, 0x74, 0x68, 0x63, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x6d, 0x61, 0x74, 0x68,
+            0x63, 0x5f, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x00, 0xbb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x5c, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0a, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x12, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x3e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x75, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xf8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xc6, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xde, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x0d, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62,
+            0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x61,
+            0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x72, 0x6f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x2e, 0x62,
+            0x73, 0x73, 0x00, 0x2e, 0x6e, 0x6f, 0x74, 0x65, 0x2e, 0x47, 0x4e, 0x55, 0x2d, 0x73, 0x74, 0x61,
+            0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+            0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+            0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x18, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xe0, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+            0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xf0, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xe0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        };
+        constexpr u8 runtime_shortest[] = {
+            0x7f, 0x45, 0x4c, 0x46, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x3e, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x09, 0x00, 0x08, 0x00,
+            0x49, 0x89, 0xf8, 0x48, 0x89, 0xf7, 0x45, 0x8b, 0x88, 0xc0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xc9,
+            0x7e, 0x5c, 0x49, 0x63, 0xc1, 0x4c, 0x89, 0xc1, 0x31, 0xf6, 0x4d, 0x8d, 0x14, 0x80, 0x66, 0x90,
+            0x8b, 0x01, 0x48, 0xf7, 0xe7, 0x48, 0x01, 0xf0, 0x48, 0x83, 0xd2, 0x00, 0x89, 0x01, 0x48, 0xc1,
+            0xe8, 0x20, 0x48, 0x83, 0xc1, 0x04, 0x48, 0xc1, 0xe2, 0x20, 0x48, 0x89, 0xd6, 0x48, 0x09, 0xc6,
+            0x4c, 0x39, 0xd1, 0x75, 0xdb, 0x48, 0x85, 0xf6, 0x74, 0x24, 0x41, 0x8d, 0x51, 0x01, 0x48, 0x63,
+            0xc2, 0x41, 0x89, 0x74, 0x80, 0xfc, 0x48, 0x83, 0xc0, 0x01, 0x48, 0xc1, 0xee, 0x20, 0x74, 0x07,
+            0x41, 0x89, 0x74, 0x80, 0xfc, 0x89, 0xc2, 0x41, 0x89, 0x90, 0xc0, 0x00, 0x00, 0x00, 0xc3, 0x90,
+            0x4c, 0x63, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xdb, 0x0f, 0x84, 0xe8, 0x00, 0x00, 0x00,
+            0x85, 0xf6, 0x44, 0x8d, 0x46, 0x1f, 0x89, 0xf0, 0x41, 0x89, 0xf1, 0x44, 0x0f, 0x49, 0xc6, 0xc1,
+            0xf8, 0x1f, 0x45, 0x89, 0xca, 0x41, 0x55, 0xc1, 0xe8, 0x1b, 0x41, 0x54, 0x41, 0x8d, 0x53, 0xff,
+            0x8d, 0x34, 0x06, 0x41, 0xc1, 0xf8, 0x05, 0x55, 0x83, 0xe6, 0x1f, 0x53, 0x43, 0x8d, 0x1c, 0x03,
+            0x29, 0xc6, 0x41, 0x83, 0xe2, 0x1f, 0x75, 0x60, 0x31, 0xed, 0x48, 0x63, 0xc2, 0x45, 0x85, 0xdb,
+            0x0f, 0x8e, 0xc0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xd2, 0x41, 0xbd, 0x20, 0x00, 0x00, 0x00, 0x41,
+            0x0f, 0x95, 0xc4, 0x44, 0x01, 0xc2, 0x41, 0x29, 0xf5, 0x48, 0x63, 0xd2, 0x4c, 0x29, 0xda, 0x4c,
+            0x8d, 0x1c, 0x97, 0xeb, 0x23, 0x0f, 0x1f, 0x00, 0x8b, 0x74, 0x87, 0xfc, 0x44, 0x89, 0xe9, 0xd3,
+            0xee, 0x8b, 0x14, 0x87, 0x44, 0x89, 0xd1, 0xd3, 0xe2, 0x09, 0xf2, 0x41, 0x89, 0x54, 0x83, 0x04,
+            0x48, 0x83, 0xe8, 0x01, 0x85, 0xc0, 0x78, 0x28, 0x85, 0xc0, 0x7e, 0x05, 0x45, 0x84, 0xe4, 0x75,
+            0xd7, 0x31, 0xf6, 0xeb, 0xdc, 0x0f, 0x1f, 0x00, 0x48, 0x63, 0xc2, 0xb9, 0x20, 0x00, 0x00, 0x00,
+            0x8b, 0x2c, 0x87, 0x29, 0xf1, 0xd3, 0xed, 0x85, 0xd2, 0x79, 0x9b, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x41, 0x83, 0xf9, 0x1f, 0x7e, 0x1a, 0x31, 0xc0, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xc7, 0x04, 0x87, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc0, 0x01, 0x41, 0x39, 0xc0, 0x7f, 0xf0,
+            0x85, 0xed, 0x75, 0x1c, 0x89, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d,
+            0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+            0x8d, 0x43, 0x01, 0x48, 0x63, 0xdb, 0x89, 0x87, 0xc0, 0x00, 0x00, 0x00, 0x89, 0x2c, 0x9f, 0x5b,
+            0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xc3, 0x41, 0x83, 0xf9, 0x1f, 0x7f, 0xaa, 0xeb, 0xc6, 0x66, 0x90,
+            0x44, 0x8b, 0x9f, 0xc0, 0x00, 0x00, 0x00, 0x48, 0x89, 0xf9, 0x45, 0x85, 0xdb, 0x7e, 0x67, 0x44,
+            0x8b, 0x96, 0xc0, 0x00, 0x00, 0x00, 0x4d, 0x63, 0xcb, 0x31, 0xc0, 0x45, 0x31, 0xc0, 0x66, 0x90,
+            0x8b, 0x14, 0x81, 0x31, 0xff, 0x41, 0x39, 0xc2, 0x7e, 0x03, 0x8b, 0x3c, 0x86, 0x48, 0x29, 0xfa,
+            0x4c, 0x29, 0xc2, 0x89, 0x14, 0x81, 0x48, 0xc1, 0xea, 0x3f, 0x48, 0x83, 0xc0, 0x01, 0x49, 0x89,
+            0xd0, 0x4c, 0x39, 0xc8, 0x75, 0xda, 0x41, 0x83, 0xeb, 0x01, 0x48, 0x83, 0xe8, 0x02, 0x49, 0x63,
+            0xd3, 0x45, 0x89, 0xdb, 0x4c, 0x29, 0xd8, 0xeb, 0x16, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+            0x89, 0x91, 0xc0, 0x00, 0x00, 0x00, 0x48, 0x83, 0xea, 0x01, 0x48, 0x39, 0xd0, 0x74, 0x07, 0x8b,
+            0x34, 0x91, 0x85, 0xf6, 0x74, 0xea, 0xc3, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x41, 0x55, 0xc7, 0x81, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x54, 0x41, 0x89,
+            0xd4, 0x55, 0x48, 0x89, 0xcd, 0x53, 0x4c, 0x89, 0xc3, 0x48, 0x85, 0xff, 0x74, 0x1a, 0x89, 0x39,
+            0x48, 0xc1, 0xef, 0x20, 0x0f, 0x84, 0x9a, 0x00, 0x00, 0x00, 0x89, 0x79, 0x04, 0xb8, 0x02, 0x00,
+            0x00, 0x00, 0x89, 0x85, 0xc0, 0x00, 0x00, 0x00, 0x89, 0xf0, 0xc7, 0x03, 0x01, 0x00, 0x00, 0x00,
+            0x48, 0x89, 0xef, 0x45, 0x89, 0xe5, 0xc7, 0x83, 0xc0, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+            0xf7, 0xd8, 0x0f, 0x48, 0xc6, 0x85, 0xf6, 0x48, 0x0f, 0x4e, 0xfb, 0x89, 0xc6, 0xe8, 0xfe, 0xfd,
+            0xff, 0xff, 0x41, 0xf7, 0xdd, 0x45, 0x0f, 0x48, 0xec, 0x45, 0x85, 0xe4, 0x48, 0x0f, 0x4f, 0xdd,
+            0x45, 0x89, 0xeb, 0x41, 0x83, 0xfd, 0x1b, 0x7e, 0x24, 0x48, 0xbd, 0x9d, 0x07, 0x10, 0xfa, 0x93,
+            0xc7, 0x65, 0x67, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x89, 0xee, 0x48, 0x89, 0xdf, 0x41, 0x83,
+            0xeb, 0x1b, 0xe8, 0x59, 0xfd, 0xff, 0xff, 0x41, 0x83, 0xfb, 0x1b, 0x7f, 0xeb, 0x48, 0x8d, 0x05,
+            0x00, 0x00, 0x00, 0x00, 0x4d, 0x63, 0xdb, 0x48, 0x89, 0xdf, 0x4a, 0x8b, 0x34, 0xd8, 0xe8, 0x3d,
+            0xfd, 0xff, 0xff, 0x44, 0x89, 0xee, 0x48, 0x89, 0xdf, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0xe9,
+            0x9c, 0xfd, 0xff, 0xff, 0xb8, 0x01, 0x00, 0x00, 0x00, 0xe9, 0x64, 0xff, 0xff, 0xff, 0x66, 0x90,
+            0x41, 0x57, 0x41, 0x56, 0x41, 0x55, 0x41, 0x89, 0xf5, 0x41, 0x54, 0x55, 0x48, 0x89, 0xfd, 0x53,
+            0x48, 0x89, 0xd3, 0x89, 0xca, 0x4c, 0x8d, 0x7c, 0x2d, 0x00, 0x48, 0x81, 0xec, 0x78, 0x02, 0x00,
+            0x00, 0x4c, 0x8d, 0xa4, 0x24, 0xd0, 0x00, 0x00, 0x00, 0x49, 0x89, 0xe6, 0x4d, 0x89, 0xe0, 0x4c,
+            0x89, 0xf1, 0xe8, 0xf9, 0xfe, 0xff, 0xff, 0x48, 0x89, 0xde, 0x4c, 0x89, 0xe7, 0xe8, 0xde, 0xfc,
+            0xff, 0xff, 0x8b, 0x9c, 0x24, 0xc0, 0x00, 0x00, 0x00, 0x39, 0x9c, 0x24, 0x90, 0x01, 0x00, 0x00,
+            0x74, 0x6e, 0x0f, 0x8c, 0x94, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xf6, 0x4c, 0x89, 0xe7, 0xe8, 0x4d,
+            0xfe, 0xff, 0xff, 0x4c, 0x89, 0xfe, 0x4c, 0x89, 0xe7, 0xe8, 0xb2, 0xfc, 0xff, 0xff, 0x3b, 0x9c,
+            0x24, 0x90, 0x01, 0x00, 0x00, 0x74, 0x19, 0x0f, 0x9f, 0xc0, 0x0f, 0xb6, 0xc0, 0x48, 0x81, 0xc4,
+            0x78, 0x02, 0x00, 0x00, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x90,
+            0x83, 0xeb, 0x01, 0x0f, 0x88, 0x2f, 0x02, 0x00, 0x00, 0x48, 0x63, 0xd3, 0xeb, 0x0e, 0x66, 0x90,
+            0x48, 0x83, 0xea, 0x01, 0x85, 0xd2, 0x0f, 0x88, 0x1c, 0x02, 0x00, 0x00, 0x41, 0x8b, 0x04, 0x96,
+            0x41, 0x39, 0x04, 0x94, 0x74, 0xea, 0x0f, 0x92, 0xc0, 0x0f, 0xb6, 0xc0, 0xeb, 0xbf, 0x66, 0x90,
+            0x89, 0xda, 0x83, 0xea, 0x01, 0x78, 0x91, 0x48, 0x63, 0xd2, 0xeb, 0x10, 0x0f, 0x1f, 0x40, 0x00,
+            0x48, 0x83, 0xea, 0x01, 0x85, 0xd2, 0x0f, 0x88, 0x7c, 0xff, 0xff, 0xff, 0x41, 0x8b, 0x04, 0x96,
+            0x41, 0x39, 0x04, 0x94, 0x74, 0xea, 0x0f, 0x83, 0x6c, 0xff, 0xff, 0xff, 0x66, 0x0f, 0x6f, 0x04,
+            0x24, 0x66, 0x0f, 0x6f, 0x4c, 0x24, 0x10, 0x4c, 0x89, 0xe6, 0x48, 0x8d, 0xbc, 0x24, 0xa0, 0x01,
+            0x00, 0x00, 0x66, 0x0f, 0x6f, 0x54, 0x24, 0x20, 0x66, 0x0f, 0x6f, 0x5c, 0x24, 0x30, 0x66, 0x0f,
+            0x6f, 0x64, 0x24, 0x40, 0x66, 0x0f, 0x6f, 0x6c, 0x24, 0x50, 0x0f, 0x29, 0x84, 0x24, 0xa0, 0x01,
+            0x00, 0x00, 0x66, 0x0f, 0x6f, 0x74, 0x24, 0x60, 0x66, 0x0f, 0x6f, 0x7c, 0x24, 0x70, 0x0f, 0x29,
+            0x8c, 0x24, 0xb0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x84, 0x24, 0x80, 0x00, 0x00, 0x00, 0x8b,
+            0x84, 0x24, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0x29, 0x94, 0x24, 0xc0, 0x01, 0x00, 0x00, 0x66, 0x0f,
+            0x6f, 0x8c, 0x24, 0x90, 0x00, 0x00, 0x00, 0x0f, 0x29, 0x9c, 0x24, 0xd0, 0x01, 0x00, 0x00, 0x66,
+            0x0f, 0x6f, 0x94, 0x24, 0xa0, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x9c, 0x24, 0xb0, 0x00, 0x00,
+            0x00, 0x89, 0x84, 0x24, 0x60, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xa4, 0x24, 0xe0, 0x01, 0x00, 0x00,
+            0x0f, 0x29, 0xac, 0x24, 0xf0, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xb4, 0x24, 0x00, 0x02, 0x00, 0x00,
+            0x0f, 0x29, 0xbc, 0x24, 0x10, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x84, 0x24, 0x20, 0x02, 0x00, 0x00,
+            0x0f, 0x29, 0x8c, 0x24, 0x30, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x94, 0x24, 0x40, 0x02, 0x00, 0x00,
+            0x0f, 0x29, 0x9c, 0x24, 0x50, 0x02, 0x00, 0x00, 0xe8, 0xf3, 0xfc, 0xff, 0xff, 0x8b, 0x84, 0x24,
+            0x60, 0x02, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0xa4, 0x24, 0xa0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f,
+            0xac, 0x24, 0xb0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0xb4, 0x24, 0xc0, 0x01, 0x00, 0x00, 0x66,
+            0x0f, 0x6f, 0xbc, 0x24, 0xd0, 0x01, 0x00, 0x00, 0x89, 0x84, 0x24, 0x90, 0x01, 0x00, 0x00, 0x48,
+            0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x66, 0x0f, 0x6f, 0x84, 0x24, 0xe0, 0x01,
+            0x00, 0x00, 0x66, 0x0f, 0x6f, 0x8c, 0x24, 0xf0, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xa4, 0x24, 0xd0,
+            0x00, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x94, 0x24, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xac, 0x24,
+            0xe0, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x9c, 0x24, 0x10, 0x02, 0x00, 0x00, 0x66, 0x0f, 0x6f,
+            0xa4, 0x24, 0x20, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xb4, 0x24, 0xf0, 0x00, 0x00, 0x00, 0x66, 0x0f,
+            0x6f, 0xac, 0x24, 0x30, 0x02, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0xb4, 0x24, 0x40, 0x02, 0x00, 0x00,
+            0x0f, 0x29, 0xbc, 0x24, 0x00, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0xbc, 0x24, 0x50, 0x02, 0x00,
+            0x00, 0x0f, 0x29, 0x84, 0x24, 0x10, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x8c, 0x24, 0x20, 0x01, 0x00,
+            0x00, 0x0f, 0x29, 0x94, 0x24, 0x30, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x9c, 0x24, 0x40, 0x01, 0x00,
+            0x00, 0x0f, 0x29, 0xa4, 0x24, 0x50, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xac, 0x24, 0x60, 0x01, 0x00,
+            0x00, 0x0f, 0x29, 0xb4, 0x24, 0x70, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xbc, 0x24, 0x80, 0x01, 0x00,
+            0x00, 0x48, 0x39, 0xc5, 0x0f, 0x85, 0xb9, 0xfd, 0xff, 0xff, 0x41, 0x81, 0xfd, 0xcf, 0xfb, 0xff,
+            0xff, 0x48, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x4c, 0x0f, 0x4d, 0xf8, 0xe9,
+            0x9f, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x40, 0x00, 0x48, 0x89, 0xe8, 0x48, 0xf7, 0xd0, 0x83, 0xe0,
+            0x01, 0xe9, 0xa7, 0xfd, 0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x41, 0x57, 0x41, 0x89, 0xf2, 0x89, 0xd6, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48,
+            0x81, 0xec, 0x88, 0x02, 0x00, 0x00, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x83, 0xfa, 0x1b, 0x0f, 0x87,
+            0x6c, 0x02, 0x00, 0x00, 0x46, 0x8d, 0x04, 0x16, 0x48, 0x63, 0xd2, 0x48, 0x8d, 0x0d, 0x00, 0x00,
+            0x00, 0x00, 0x48, 0x89, 0xf8, 0x48, 0xf7, 0x24, 0xd1, 0x41, 0x83, 0xf8, 0x3f, 0x0f, 0x86, 0xe2,
+            0x02, 0x00, 0x00, 0x41, 0x83, 0xf8, 0x81, 0x72, 0x27, 0x41, 0x83, 0xf8, 0xc1, 0x0f, 0x8c, 0xd6,
+            0x03, 0x00, 0x00, 0x45, 0x89, 0xc1, 0x48, 0x89, 0xd3, 0x41, 0xf7, 0xd9, 0x44, 0x89, 0xc9, 0x48,
+            0xd3, 0xeb, 0x48, 0x85, 0xdb, 0x0f, 0x84, 0x36, 0x04, 0x00, 0x00, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x4c, 0x8d, 0xa4, 0x24, 0xe0, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x6c, 0x24, 0x10, 0x89, 0xf2, 0x44,
+            0x89, 0xd6, 0x4d, 0x89, 0xe0, 0x4c, 0x89, 0xe9, 0xe8, 0xc3, 0xfb, 0xff, 0xff, 0x44, 0x8b, 0xbc,
+            0x24, 0xd0, 0x00, 0x00, 0x00, 0x45, 0x85, 0xff, 0x0f, 0x84, 0x72, 0x02, 0x00, 0x00, 0x41, 0x8d,
+            0x47, 0xff, 0x8b, 0xbc, 0x24, 0xa0, 0x01, 0x00, 0x00, 0x48, 0x98, 0x0f, 0xbd, 0x54, 0x84, 0x10,
+            0x44, 0x89, 0xf8, 0xc1, 0xe0, 0x05, 0x89, 0x7c, 0x24, 0x04, 0x83, 0xf2, 0x1f, 0x29, 0xd0, 0x41,
+            0x89, 0xc6, 0x85, 0xff, 0x0f, 0x85, 0xcf, 0x02, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x0f, 0x88, 0x84,
+            0x03, 0x00, 0x00, 0x31, 0xed, 0x48, 0x8d, 0x9c, 0x24, 0xb0, 0x01, 0x00, 0x00, 0xeb, 0x2e, 0x90,
+            0x7c, 0x19, 0x48, 0x89, 0xde, 0x4c, 0x89, 0xef, 0xe8, 0xe3, 0xfa, 0xff, 0xff, 0xba, 0x01, 0x00,
+            0x00, 0x00, 0x44, 0x89, 0xf1, 0x48, 0xd3, 0xe2, 0x48, 0x09, 0xd5, 0x41, 0x83, 0xee, 0x01, 0x0f,
+            0x82, 0x3b, 0x01, 0x00, 0x00, 0x44, 0x8b, 0xbc, 0x24, 0xd0, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x6f,
+            0x84, 0x24, 0xe0, 0x00, 0x00, 0x00, 0x44, 0x89, 0xf6, 0x48, 0x89, 0xdf, 0x66, 0x0f, 0x6f, 0x8c,
+            0x24, 0xf0, 0x00, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x94, 0x24, 0x00, 0x01, 0x00, 0x00, 0x8b, 0x94,
+            0x24, 0xa0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x9c, 0x24, 0x10, 0x01, 0x00, 0x00, 0x66, 0x0f,
+            0x6f, 0xa4, 0x24, 0x20, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x84, 0x24, 0xb0, 0x01, 0x00, 0x00, 0x66,
+            0x0f, 0x6f, 0xac, 0x24, 0x30, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x8c, 0x24, 0xc0, 0x01, 0x00, 0x00,
+            0x66, 0x0f, 0x6f, 0xb4, 0x24, 0x40, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0xbc, 0x24, 0x50, 0x01,
+            0x00, 0x00, 0x0f, 0x29, 0x94, 0x24, 0xd0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x84, 0x24, 0x60,
+            0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x8c, 0x24, 0x70, 0x01, 0x00, 0x00, 0x0f, 0x29, 0x9c, 0x24,
+            0xe0, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f, 0x94, 0x24, 0x80, 0x01, 0x00, 0x00, 0x66, 0x0f, 0x6f,
+            0x9c, 0x24, 0x90, 0x01, 0x00, 0x00, 0x89, 0x94, 0x24, 0x70, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xa4,
+            0x24, 0xf0, 0x01, 0x00, 0x00, 0x0f, 0x29, 0xac, 0x24, 0x00, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xb4,
+            0x24, 0x10, 0x02, 0x00, 0x00, 0x0f, 0x29, 0xbc, 0x24, 0x20, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x84,
+            0x24, 0x30, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x8c, 0x24, 0x40, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x94,
+            0x24, 0x50, 0x02, 0x00, 0x00, 0x0f, 0x29, 0x9c, 0x24, 0x60, 0x02, 0x00, 0x00, 0xe8, 0xbe, 0xf8,
+            0xff, 0xff, 0x44, 0x3b, 0xbc, 0x24, 0x70, 0x02, 0x00, 0x00, 0x0f, 0x85, 0xe0, 0xfe, 0xff, 0xff,
+            0x41, 0x83, 0xef, 0x01, 0x0f, 0x88, 0xd8, 0xfe, 0xff, 0xff, 0x49, 0x63, 0xd7, 0xeb, 0x0d, 0x90,
+            0x48, 0x83, 0xea, 0x01, 0x85, 0xd2, 0x0f, 0x88, 0xc6, 0xfe, 0xff, 0xff, 0x8b, 0x04, 0x93, 0x41,
+            0x39, 0x44, 0x95, 0x00, 0x74, 0xea, 0x0f, 0x83, 0xb6, 0xfe, 0xff, 0xff, 0x41, 0x83, 0xee, 0x01,
+            0x0f, 0x83, 0xcf, 0xfe, 0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xbe, 0x01, 0x00, 0x00, 0x00, 0x4c, 0x89, 0xef, 0xe8, 0x63, 0xf8, 0xff, 0xff, 0x8b, 0x44, 0x24,
+            0x04, 0x39, 0x84, 0x24, 0xd0, 0x00, 0x00, 0x00, 0x0f, 0x84, 0x02, 0x01, 0x00, 0x00, 0x40, 0x0f,
+            0x9d, 0xc6, 0x40, 0x0f, 0xb6, 0xf6, 0x8d, 0x74, 0x36, 0xff, 0x48, 0x8b, 0x44, 0x24, 0x08, 0x89,
+            0x30, 0x48, 0x81, 0xc4, 0x88, 0x02, 0x00, 0x00, 0x48, 0x89, 0xe8, 0x5b, 0x5d, 0x41, 0x5c, 0x41,
+            0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x83, 0xfa, 0xe5, 0x0f, 0x82, 0xd7, 0xfd, 0xff, 0xff, 0x42, 0x8d, 0x04, 0x12, 0x83, 0xf8, 0x3f,
+            0x0f, 0x87, 0x2c, 0x01, 0x00, 0x00, 0x85, 0xc0, 0x0f, 0x84, 0x41, 0x02, 0x00, 0x00, 0xb9, 0x40,
+            0x00, 0x00, 0x00, 0x48, 0x89, 0xfa, 0x48, 0x89, 0xfb, 0x29, 0xc1, 0x48, 0xd3, 0xea, 0x89, 0xc1,
+            0x48, 0xd3, 0xe3, 0x48, 0x89, 0xd8, 0x89, 0xf1, 0x4c, 0x8d, 0x05, 0x00, 0x00, 0x00, 0x00, 0xf7,
+            0xd9, 0x48, 0x63, 0xc9, 0x49, 0x8b, 0x0c, 0xc8, 0x48, 0x39, 0xca, 0x0f, 0x83, 0x8f, 0xfd, 0xff,
+            0xff, 0x48, 0xf7, 0xf1, 0x48, 0x29, 0xd1, 0x48, 0x89, 0xc5, 0xbe, 0xff, 0xff, 0xff, 0xff, 0x48,
+            0x39, 0xca, 0x0f, 0x82, 0x72, 0xff, 0xff, 0xff, 0x31, 0xf6, 0x48, 0x39, 0xd1, 0x40, 0x0f, 0x92,
+            0xc6, 0xe9, 0x64, 0xff, 0xff, 0xff, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x44, 0x8b, 0xb4, 0x24, 0xa0, 0x01, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x0f, 0x84, 0xa4, 0x00, 0x00,
+            0x00, 0x31, 0xc0, 0xeb, 0x77, 0x48, 0x85, 0xd2, 0x0f, 0x85, 0x42, 0xfd, 0xff, 0xff, 0x45, 0x85,
+            0xc0, 0x74, 0x17, 0xb9, 0x40, 0x00, 0x00, 0x00, 0x48, 0x89, 0xc2, 0x44, 0x29, 0xc1, 0x48, 0xd3,
+            0xea, 0x48, 0x85, 0xd2, 0x0f, 0x85, 0x26, 0xfd, 0xff, 0xff, 0x44, 0x89, 0xc1, 0xbe, 0xff, 0xff,
+            0xff, 0xff, 0x48, 0xd3, 0xe0, 0x48, 0x89, 0xc5, 0xe9, 0x0d, 0xff, 0xff, 0xff, 0x0f, 0x1f, 0x00,
+            0x8b, 0x5c, 0x24, 0x04, 0x83, 0xeb, 0x01, 0x0f, 0x88, 0xe3, 0x00, 0x00, 0x00, 0x48, 0x63, 0xc3,
+            0xeb, 0x12, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00, 0x48, 0x83, 0xe8, 0x01, 0x85, 0xc0, 0x0f, 0x88,
+            0xcc, 0x00, 0x00, 0x00, 0x41, 0x8b, 0x0c, 0x84, 0x41, 0x39, 0x4c, 0x85, 0x00, 0x74, 0xe9, 0x19,
+            0xf6, 0x83, 0xce, 0x01, 0xe9, 0xd1, 0xfe, 0xff, 0xff, 0x41, 0x89, 0xfe, 0x41, 0x8d, 0x56, 0xff,
+            0x44, 0x89, 0x74, 0x24, 0x04, 0x48, 0x63, 0xd2, 0x0f, 0xbd, 0xb4, 0x94, 0xe0, 0x00, 0x00, 0x00,
+            0x44, 0x89, 0xf2, 0xc1, 0xe2, 0x05, 0x83, 0xf6, 0x1f, 0x29, 0xf2, 0x29, 0xd0, 0x41, 0x89, 0xc6,
+            0xe9, 0x05, 0xfd, 0xff, 0xff, 0xc7, 0x44, 0x24, 0x04, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x01, 0xfd,
+            0xff, 0xff, 0x83, 0xf8, 0xc1, 0x0f, 0x82, 0x95, 0xfc, 0xff, 0xff, 0xf7, 0xde, 0x48, 0x8d, 0x0d,
+            0x00, 0x00, 0x00, 0x00, 0x48, 0x63, 0xd6, 0x48, 0x8b, 0x14, 0xd1, 0x8d, 0x48, 0x40, 0x48, 0x89,
+            0xd6, 0x48, 0xd3, 0xee, 0x48, 0x85, 0xf6, 0x75, 0x65, 0xf7, 0xd8, 0xbe, 0xff, 0xff, 0xff, 0xff,
+            0x89, 0xc1, 0x48, 0x89, 0xf8, 0x48, 0xd3, 0xe2, 0x48, 0x89, 0xd1, 0x31, 0xd2, 0x48, 0xf7, 0xf1,
+            0x48, 0x01, 0xd2, 0x48, 0x39, 0xca, 0x72, 0x09, 0x31, 0xf6, 0x48, 0x39, 0xd1, 0x40, 0x0f, 0x92,
+            0xc6, 0x48, 0x89, 0xc5, 0xe9, 0x41, 0xfe, 0xff, 0xff, 0x41, 0x83, 0xf8, 0xc0, 0x75, 0x3b, 0xbe,
+            0xff, 0xff, 0xff, 0xff, 0x48, 0x85, 0xc0, 0x0f, 0x88, 0xca, 0x00, 0x00, 0x00, 0xb9, 0xc0, 0xff,
+            0xff, 0xff, 0x44, 0x29, 0xc1, 0x48, 0xd3, 0xea, 0x48, 0x89, 0xd5, 0xe9, 0x1a, 0xfe, 0xff, 0xff,
+            0x31, 0xf6, 0xe9, 0x13, 0xfe, 0xff, 0xff, 0x31, 0xed, 0xe9, 0xe2, 0xfd, 0xff, 0xff, 0xbe, 0xff,
+            0xff, 0xff, 0xff, 0x31, 0xed, 0xe9, 0x00, 0xfe, 0xff, 0xff, 0xb9, 0xbf, 0xff, 0xff, 0xff, 0xbf,
+            0x01, 0x00, 0x00, 0x00, 0x48, 0xc7, 0xc6, 0xff, 0xff, 0xff, 0xff, 0x44, 0x29, 0xc1, 0x48, 0xd3,
+            0xe7, 0xb9, 0xc0, 0xff, 0xff, 0xff, 0x44, 0x29, 0xc1, 0x48, 0xd3, 0xe6, 0x48, 0x89, 0xf1, 0x48,
+            0xf7, 0xd1, 0x48, 0x21, 0xd1, 0x48, 0x39, 0xf9, 0x74, 0x5f, 0x19, 0xf6, 0x83, 0xce, 0x01, 0xeb,
+            0x9c, 0x44, 0x89, 0xc1, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0xc7, 0xc6, 0xff, 0xff, 0xff, 0xff,
+            0xf7, 0xd1, 0x48, 0xd3, 0xe7, 0x44, 0x89, 0xc9, 0x48, 0xd3, 0xe6, 0x48, 0x89, 0xf1, 0xbe, 0xff,
+            0xff, 0xff, 0xff, 0x48, 0xf7, 0xd1, 0x48, 0x21, 0xc1, 0x48, 0x39, 0xf9, 0x72, 0x09, 0x31, 0xf6,
+            0x48, 0x39, 0xcf, 0x40, 0x0f, 0x92, 0xc6, 0x41, 0x8d, 0x48, 0x40, 0x48, 0xd3, 0xe2, 0x44, 0x89,
+            0xc9, 0x48, 0xd3, 0xe8, 0x48, 0x89, 0xc5, 0x48, 0x09, 0xd5, 0xe9, 0x7b, 0xfd, 0xff, 0xff, 0x48,
+            0x89, 0xf8, 0x31, 0xd2, 0xe9, 0xcd, 0xfd, 0xff, 0xff, 0x31, 0xf6, 0x48, 0x85, 0xc0, 0x40, 0x0f,
+            0x95, 0xc6, 0xe9, 0x36, 0xff, 0xff, 0xff, 0xb9, 0x01, 0x00, 0x00, 0x00, 0x31, 0xf6, 0x48, 0xc1,
+            0xe1, 0x3f, 0x48, 0x39, 0xc1, 0x40, 0x0f, 0x92, 0xc6, 0xe9, 0x1f, 0xff, 0xff, 0xff, 0x66, 0x90,
+            0x41, 0x57, 0x48, 0x8d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x44, 0x8d, 0x46, 0x3f, 0x41, 0x56, 0x41,
+            0x55, 0x41, 0x54, 0x44, 0x8d, 0x62, 0xff, 0x48, 0x63, 0xd2, 0x55, 0x89, 0xf5, 0x53, 0x48, 0x89,
+            0xfb, 0x48, 0x83, 0xec, 0x28, 0x4c, 0x8b, 0x2c, 0xd0, 0x48, 0x89, 0x4c, 0x24, 0x08, 0x49, 0x63,
+            0xcc, 0x4c, 0x8b, 0x3c, 0xc8, 0x48, 0x0f, 0xbd, 0xc7, 0x48, 0x83, 0xf0, 0x3f, 0x41, 0x29, 0xc0,
+            0x48, 0x8d, 0x44, 0x24, 0x1c, 0x45, 0x69, 0xc0, 0x41, 0x34, 0x01, 0x00, 0x48, 0x89, 0x04, 0x24,
+            0x45, 0x89, 0xc6, 0x41, 0xc1, 0xfe, 0x12, 0x44, 0x89, 0xe2, 0x48, 0x8b, 0x0c, 0x24, 0x89, 0xee,
+            0x48, 0x89, 0xdf, 0x44, 0x29, 0xf2, 0xe8, 0x75, 0xfa, 0xff, 0xff, 0x4c, 0x39, 0xe8, 0x73, 0x30,
+            0x4c, 0x39, 0xf8, 0x72, 0x4b, 0x8b, 0x54, 0x24, 0x1c, 0x85, 0xd2, 0x7e, 0x53, 0x48, 0x83, 0xc0,
+            0x01, 0x49, 0x39, 0xc5, 0x74, 0x2a, 0x48, 0x8b, 0x5c, 0x24, 0x08, 0x44, 0x89, 0x33, 0x48, 0x83,
+            0xc4, 0x28, 0x5b, 0x5d, 0x41, 0x5c, 0x41, 0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x0f, 0x1f, 0x00,
+            0x41, 0x83, 0xc6, 0x01, 0xeb, 0xb1, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x41, 0x83, 0xc6, 0x01, 0x4c, 0x89, 0xf8, 0xeb, 0xcd, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+            0x41, 0x83, 0xee, 0x01, 0xeb, 0x91, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x75, 0xb4, 0xa8, 0x01, 0x74, 0xb0, 0xeb, 0xa5, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0x8b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x48, 0x85, 0xd2, 0x74, 0x2f, 0x45, 0x31, 0xc0, 0x4c,
+            0x8d, 0x0d, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x4b, 0x8d, 0x34, 0x01, 0x4c,
+            0x29, 0xc2, 0x48, 0x89, 0xf8, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x78, 0x24, 0x49, 0x01, 0xc0, 0x48,
+            0x8b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x49, 0x39, 0xd0, 0x72, 0xe0, 0x48, 0xc7, 0x05, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0x83, 0xf8, 0xfc, 0x74, 0xd9, 0x48, 0xc7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xc3, 0x66, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x00,
+            0x41, 0x57, 0x66, 0x49, 0x0f, 0x7e, 0xc0, 0x41, 0x56, 0x41, 0x55, 0x41, 0x54, 0x55, 0x53, 0x48,
+            0x83, 0xec, 0x58, 0x48, 0x8b, 0x15, 0x00, 0x00, 0x00, 0x00, 0x48, 0x81, 0xfa, 0xe0, 0xff, 0x00,
+            0x00, 0x0f, 0x87, 0xf9, 0x01, 0x00, 0x00, 0x48, 0x8d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89,
+            0x44, 0x24, 0x18, 0x4c, 0x8d, 0x2c, 0x10, 0x49, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f,
+            0x00, 0x4c, 0x89, 0xc5, 0x48, 0xc1, 0xed, 0x34, 0x4d, 0x21, 0xc4, 0x81, 0xe5, 0xff, 0x07, 0x00,
+            0x00, 0x4d, 0x85, 0xc0, 0x79, 0x09, 0x41, 0xc6, 0x45, 0x00, 0x2d, 0x49, 0x83, 0xc5, 0x01, 0x81,
+            0xfd, 0xff, 0x07, 0x00, 0x00, 0x0f, 0x84, 0x05, 0x03, 0x00, 0x00, 0x85, 0xed, 0x0f, 0x85, 0x1d,
+            0x02, 0x00, 0x00, 0x4d, 0x85, 0xe4, 0x75, 0x38, 0x41, 0xc6, 0x45, 0x00, 0x30, 0x49, 0x8d, 0x45,
+            0x01, 0x48, 0x8b, 0x5c, 0x24, 0x18, 0xc6, 0x00, 0x0a, 0x48, 0x83, 0xc0, 0x01, 0x48, 0x29, 0xd8,
+            0x48, 0x89, 0x05, 0x00, 0x00, 0x00, 0x00, 0x48, 0x83, 0xc4, 0x58, 0x5b, 0x5d, 0x41, 0x5c, 0x41,
+            0x5d, 0x41, 0x5e, 0x41, 0x5f, 0xc3, 0x66, 0x2e, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x85, 0xed, 0x0f, 0x85, 0xd8, 0x01, 0x00, 0x00, 0xc7, 0x44, 0x24, 0x0c, 0xce, 0xfb, 0xff, 0xff,
+            0x41, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48, 0x8d, 0x44, 0x24, 0x2c, 0x8b, 0x74, 0x24, 0x0c, 0x44,
+            0x89, 0xfa, 0x4c, 0x89, 0xe7, 0x48, 0x89, 0xc1, 0x48, 0x89, 0x44, 0x24, 0x10, 0xe8, 0xce, 0xfd,
+            0xff, 0xff, 0x48, 0x89, 0xc5, 0xeb, 0x2e, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0x8b, 0x4c, 0x24, 0x10, 0x8b, 0x74, 0x24, 0x0c, 0x41, 0x83, 0xc7, 0x01, 0x4c, 0x89, 0xe7,
+            0x44, 0x89, 0xfa, 0xe8, 0xa8, 0xfd, 0xff, 0xff, 0x48, 0x89, 0xc5, 0x41, 0x83, 0xff, 0x11, 0x0f,
+            0x84, 0x4b, 0x02, 0x00, 0x00, 0x44, 0x8b, 0x74, 0x24, 0x2c, 0x41, 0x8d, 0x5f, 0xff, 0x8b, 0x74,
+            0x24, 0x0c, 0x48, 0x89, 0xea, 0x89, 0xd9, 0x4c, 0x89, 0xe7, 0x44, 0x29, 0xf1, 0xe8, 0x7e, 0xf5,
+            0xff, 0xff, 0x85, 0xc0, 0x74, 0xba, 0x48, 0x63, 0xdb, 0x48, 0x8d, 0x4c, 0x24, 0x30, 0x48, 0x8d,
+            0x7c, 0x24, 0x2f, 0x48, 0xbe, 0xcd, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x48, 0x01, 0xcb,
+            0x48, 0x89, 0xe8, 0x49, 0x89, 0xea, 0x48, 0x83, 0xeb, 0x01, 0x48, 0xf7, 0xe6, 0x48, 0xc1, 0xea,
+            0x03, 0x48, 0x8d, 0x04, 0x92, 0x48, 0x89, 0xd5, 0x48, 0x01, 0xc0, 0x49, 0x29, 0xc2, 0x41, 0x83,
+            0xc2, 0x30, 0x44, 0x88, 0x53, 0x01, 0x48, 0x39, 0xdf, 0x75, 0xd5, 0x49, 0x63, 0xc7, 0xeb, 0x12,
+            0x80, 0x7c, 0x01, 0xff, 0x30, 0x48, 0x8d, 0x50, 0xff, 0x0f, 0x85, 0x21, 0x01, 0x00, 0x00, 0x48,
+            0x89, 0xd0, 0x89, 0xc6, 0x83, 0xf8, 0x01, 0x75, 0xe7, 0x41, 0x8d, 0x46, 0x04, 0x83, 0xf8, 0x14,
+            0x0f, 0x87, 0x5a, 0x02, 0x00, 0x00, 0x45, 0x85, 0xf6, 0x0f, 0x88, 0xf1, 0x01, 0x00, 0x00, 0x45,
+            0x89, 0xf0, 0x31, 0xd2, 0x49, 0x8d, 0x40, 0x01, 0xeb, 0x09, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x48, 0x89, 0xfa, 0xbf, 0x30, 0x00, 0x00, 0x00, 0x39, 0xd6, 0x7e, 0x04, 0x0f, 0xb6, 0x3c, 0x11,
+            0x41, 0x88, 0x7c, 0x15, 0x00, 0x48, 0x8d, 0x7a, 0x01, 0x49, 0x39, 0xd0, 0x75, 0xe2, 0x41, 0x8d,
+            0x56, 0x01, 0x4c, 0x01, 0xe8, 0x39, 0xf2, 0x0f, 0x8d, 0x94, 0xfe, 0xff, 0xff, 0x4d, 0x01, 0xe8,
+            0xc6, 0x00, 0x2e, 0x48, 0x63, 0xc2, 0x49, 0x63, 0xd6, 0x4c, 0x89, 0xc7, 0x48, 0x29, 0xd7, 0x90,
+            0x0f, 0xb6, 0x14, 0x01, 0x88, 0x54, 0x07, 0x01, 0x48, 0x83, 0xc0, 0x01, 0x39, 0xc6, 0x7f, 0xf0,
+            0x44, 0x29, 0xf6, 0x8d, 0x46, 0xfe, 0x49, 0x8d, 0x44, 0x00, 0x03, 0xe9, 0x61, 0xfe, 0xff, 0xff,
+            0x48, 0x8d, 0x05, 0x00, 0x00, 0x00, 0x00, 0x45, 0x31, 0xc9, 0xbf, 0x01, 0x00, 0x00, 0x00, 0x48,
+            0x89, 0x44, 0x24, 0x18, 0x48, 0x8b, 0x44, 0x24, 0x18, 0x4c, 0x29, 0xca, 0x4a, 0x8d, 0x34, 0x08,
+            0x48, 0x89, 0xf8, 0x0f, 0x05, 0x48, 0x85, 0xc0, 0x78, 0x36, 0x49, 0x01, 0xc1, 0x48, 0x8b, 0x15,
+            0x00, 0x00, 0x00, 0x00, 0x49, 0x39, 0xd1, 0x72, 0xdb, 0x0f, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0xc7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4c, 0x8d, 0x2d, 0x00, 0x00,
+            0x00, 0x00, 0xe9, 0xc0, 0xfd, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x48, 0x83, 0xf8, 0xfc, 0x75, 0xda, 0xeb, 0xc5, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x8d, 0x85, 0xcd, 0xfb, 0xff, 0xff, 0x49, 0x0f, 0xba, 0xec, 0x34, 0x41, 0xbf, 0x0f, 0x00, 0x00,
+            0x00, 0x89, 0x44, 0x24, 0x0c, 0xe9, 0x1c, 0xfe, 0xff, 0xff, 0x66, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x41, 0x8d, 0x56, 0x04, 0x83, 0xfa, 0x14, 0x0f, 0x86, 0xe9, 0xfe, 0xff, 0xff, 0x0f, 0xb6, 0x54,
+            0x24, 0x30, 0x41, 0xc6, 0x45, 0x01, 0x2e, 0x89, 0xc7, 0x89, 0xc0, 0x41, 0x88, 0x55, 0x00, 0xba,
+            0x01, 0x00, 0x00, 0x00, 0x0f, 0x1f, 0x40, 0x00, 0x0f, 0xb6, 0x34, 0x11, 0x41, 0x88, 0x74, 0x15,
+            0x01, 0x48, 0x83, 0xc2, 0x01, 0x48, 0x39, 0xc2, 0x75, 0xee, 0x8d, 0x4f, 0x01, 0x4c, 0x01, 0xe9,
+            0x44, 0x89, 0xf0, 0x44, 0x89, 0xf2, 0xc6, 0x01, 0x65, 0x48, 0x8d, 0x71, 0x02, 0xc1, 0xf8, 0x1f,
+            0x83, 0xe0, 0x02, 0x83, 0xc0, 0x2b, 0xf7, 0xda, 0x41, 0x0f, 0x48, 0xd6, 0x88, 0x41, 0x01, 0x83,
+            0xfa, 0x63, 0x7e, 0x1d, 0x89, 0xd0, 0x48, 0x8d, 0x71, 0x03, 0x48, 0x69, 0xc0, 0x1f, 0x85, 0xeb,
+            0x51, 0x48, 0xc1, 0xe8, 0x25, 0x8d, 0x78, 0x30, 0x6b, 0xc0, 0x64, 0x40, 0x88, 0x79, 0x02, 0x29,
+            0xc2, 0x89, 0xd1, 0xb8, 0xcd, 0xcc, 0xcc, 0xcc, 0x48, 0x0f, 0xaf, 0xc8, 0x48, 0xc1, 0xe9, 0x23,
+            0x8d, 0x41, 0x30, 0x8d, 0x0c, 0x89, 0x01, 0xc9, 0x88, 0x06, 0x48, 0x8d, 0x46, 0x02, 0x29, 0xca,
+            0x83, 0xc2, 0x30, 0x88, 0x56, 0x01, 0xe9, 0x26, 0xfd, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x44, 0x8b, 0x74, 0x24, 0x2c, 0xbb, 0x10, 0x00, 0x00, 0x00, 0xe9, 0xc7, 0xfd, 0xff, 0xff, 0x90,
+            0x48, 0x8d, 0x15, 0x00, 0x00, 0x00, 0x00, 0x4d, 0x85, 0xe4, 0x48, 0x8d, 0x05, 0x00, 0x00, 0x00,
+            0x00, 0x48, 0x0f, 0x45, 0xc2, 0x0f, 0xb7, 0x10, 0x0f, 0xb6, 0x40, 0x02, 0x66, 0x41, 0x89, 0x55,
+            0x00, 0x41, 0x88, 0x45, 0x02, 0x49, 0x8d, 0x45, 0x03, 0xe9, 0xe3, 0xfc, 0xff, 0xff, 0x66, 0x90,
+            0x0f, 0xb7, 0x05, 0x00, 0x00, 0x00, 0x00, 0x49, 0x8d, 0x55, 0x02, 0x66, 0x41, 0x89, 0x45, 0x00,
+            0x48, 0x89, 0xd0, 0x41, 0x83, 0xfe, 0xff, 0x74, 0x1a, 0xb8, 0xfe, 0xff, 0xff, 0xff, 0x44, 0x29,
+            0xf0, 0x49, 0x8d, 0x44, 0x05, 0x03, 0x48, 0x83, 0xc2, 0x01, 0xc6, 0x42, 0xff, 0x30, 0x48, 0x39,
+            0xc2, 0x75, 0xf3, 0x4c, 0x63, 0xc6, 0x31, 0xd2, 0x0f, 0x1f, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x0f, 0xb6, 0x3c, 0x11, 0x40, 0x88, 0x3c, 0x10, 0x48, 0x83, 0xc2, 0x01, 0x49, 0x39, 0xd0, 0x75,
+            0xef, 0x89, 0xf6, 0x48, 0x01, 0xf0, 0xe9, 0x86, 0xfc, 0xff, 0xff, 0x0f, 0x1f, 0x44, 0x00, 0x00,
+            0x0f, 0xb6, 0x44, 0x24, 0x30, 0x49, 0x8d, 0x4d, 0x01, 0x41, 0x88, 0x45, 0x00, 0xe9, 0xde, 0xfe,
+            0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x6e, 0x61, 0x6e, 0x00, 0x69, 0x6e, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x10, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x86, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x40, 0x42, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x96, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xe1, 0xf5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0x9a, 0x3b, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0xe4, 0x0b, 0x54, 0x02, 0x00, 0x00, 0x00, 0x00, 0xe8, 0x76, 0x48, 0x17, 0x00, 0x00, 0x00,
+            0x00, 0x10, 0xa5, 0xd4, 0xe8, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x72, 0x4e, 0x18, 0x09, 0x00, 0x00,
+            0x00, 0x40, 0x7a, 0x10, 0xf3, 0x5a, 0x00, 0x00, 0x00, 0x80, 0xc6, 0xa4, 0x7e, 0x8d, 0x03, 0x00,
+            0x00, 0x00, 0xc1, 0x6f, 0xf2, 0x86, 0x23, 0x00, 0x00, 0x00, 0x8a, 0x5d, 0x78, 0x45, 0x63, 0x01,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x71, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x09, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0x31, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xe1, 0xf5, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0xcd, 0x1d, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xf9, 0x02, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0x0e, 0xe9, 0x02, 0x00, 0x00, 0x00, 0x00,
+            0x51, 0x4a, 0x8d, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x95, 0x73, 0xc2, 0x48, 0x00, 0x00, 0x00, 0x00,
+            0xe9, 0x41, 0xcc, 0x6b, 0x01, 0x00, 0x00, 0x00, 0x8d, 0x49, 0xfd, 0x1a, 0x07, 0x00, 0x00, 0x00,
+            0xc1, 0x6f, 0xf2, 0x86, 0x23, 0x00, 0x00, 0x00, 0xc5, 0x2e, 0xbc, 0xa2, 0xb1, 0x00, 0x00, 0x00,
+            0xd9, 0xe9, 0xac, 0x2d, 0x78, 0x03, 0x00, 0x00, 0x3d, 0x91, 0x60, 0xe4, 0x58, 0x11, 0x00, 0x00,
+            0x31, 0xd6, 0xe2, 0x75, 0xbc, 0x56, 0x00, 0x00, 0xf5, 0x2e, 0x6e, 0x4d, 0xae, 0xb1, 0x01, 0x00,
+            0xc9, 0xea, 0x26, 0x83, 0x67, 0x78, 0x08, 0x00, 0xed, 0x95, 0xc2, 0x8f, 0x05, 0x5a, 0x2a, 0x00,
+            0xa1, 0xed, 0xcc, 0xce, 0x1b, 0xc2, 0xd3, 0x00, 0x25, 0xa4, 0x00, 0x0a, 0x8b, 0xca, 0x22, 0x04,
+            0xb9, 0x34, 0x03, 0x32, 0xb7, 0xf4, 0xad, 0x14, 0x9d, 0x07, 0x10, 0xfa, 0x93, 0xc7, 0x65, 0x67,
+            0x30, 0x2e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00,
+            0xa0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x10, 0x00, 0x00, 0x00, 0x12, 0x02, 0x01, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x12, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x12, 0x02, 0x01, 0x00,
+            0xc0, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x2e, 0x4c, 0x43, 0x30, 0x00, 0x2e, 0x4c, 0x43, 0x31, 0x00, 0x2e, 0x4c, 0x43, 0x32, 0x00,
+            0x6d, 0x61, 0x74, 0x68, 0x63, 0x5f, 0x70, 0x72, 0x69, 0x6e, 0x74, 0x00, 0x6d, 0x61, 0x74, 0x68,
+            0x63, 0x5f, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x00, 0xb0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xee, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+            0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+            0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe5, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xc3, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xf2, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x0b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x19, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x5a, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x53, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0x93, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+            0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xa3, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x02, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+            0xd3, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+            0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x2e, 0x73, 0x79, 0x6d, 0x74, 0x61, 0x62,
+            0x00, 0x2e, 0x73, 0x74, 0x72, 0x74, 0x61, 0x62, 0x00, 0x2e, 0x73, 0x68, 0x73, 0x74, 0x72, 0x74,
+            0x61, 0x62, 0x00, 0x2e, 0x72, 0x65, 0x6c, 0x61, 0x2e, 0x74, 0x65, 0x78, 0x74, 0x00, 0x2e, 0x72,
+            0x6f, 0x64, 0x61, 0x74, 0x61, 0x00, 0x2e, 0x62, 0x73, 0x73, 0x00, 0x2e, 0x6e, 0x6f, 0x74, 0x65,
+            0x2e, 0x47, 0x4e, 0x55, 0x2d, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x20, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x42, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x1b, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xe0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+            0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x26, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xa2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x2e, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x20, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x33, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+            0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x09, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x11, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        };
+    }  // namespace
+
+    span<const u8> print_runtime::object(print_format format) {
+        if (format == print_format::PRINT_SHORTEST) {
+            return runtime_shortest;
+        }
+        return runtime_g15;
+    }
+}  // namespace mathc
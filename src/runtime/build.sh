@@ -0,0 +1,55 @@
+#!/bin/bash
+# Rebuilds src/print_runtime_objects.cpp from print_runtime.c: one relocatable object per print format, compiled here
+# once so that building a program only has to link it. Needs gcc and binutils; run it (or `make runtime`) after
+# changing the runtime.
+#
+# The objects need nothing from libc or libgcc. Their code is position-independent and refers to its own data only
+# PC-relatively, and their symbols are hidden, so every relocation is R_X86_64_PC32 within the object.
+set -euo pipefail
+
+HERE="$(cd "$(dirname "$0")" && pwd)"
+OUT="$HERE/../print_runtime_objects.cpp"
+CC="${CC:-gcc}"
+LD="${LD:-ld}"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# Bytes of the object file as a C++ array body, 16 per line
+dump() {
+    od -An -v -tx1 "$1" | tr -s ' \n' '  ' | awk '{
+        for (i = 1; i <= NF; ++i) {
+            printf "%s0x%s,", ((i - 1) % 16 == 0 ? (i == 1 ? "" : "\n") "            " : " "), $i;
+        }
+        printf "\n";
+    }'
+}
+
+{
+    echo "// Generated by src/runtime/build.sh from src/runtime/print_runtime.c; do not edit."
+    echo ""
+    echo "#include \"print_runtime.hpp\""
+    echo ""
+    echo "namespace mathc {"
+    echo "    namespace {"
+    for format in g15:0 shortest:1; do
+        name="${format%%:*}"
+        "$CC" -c -O2 -march=x86-64 -fPIC -fvisibility=hidden -ffreestanding -fno-builtin -fno-stack-protector \
+            -fno-asynchronous-unwind-tables -fno-jump-tables -fno-ident -Wall -Wextra -Werror \
+            -DMATHC_SHORTEST="${format##*:}" "$HERE/print_runtime.c" -o "$WORK/$name.o"
+        "$LD" -r -x -S -T "$HERE/merge.ld" "$WORK/$name.o" -o "$WORK/${name}_merged.o"
+
+        echo "        constexpr u8 runtime_$name[] = {"
+        dump "$WORK/${name}_merged.o"
+        echo "        };"
+    done
+    echo "    }  // namespace"
+    echo ""
+    echo "    span<const u8> print_runtime::object(print_format format) {"
+    echo "        if (format == print_format::PRINT_SHORTEST) {"
+    echo "            return runtime_shortest;"
+    echo "        }"
+    echo "        return runtime_g15;"
+    echo "    }"
+    echo "}  // namespace mathc"
+} > "$OUT.tmp"
+mv "$OUT.tmp" "$OUT"
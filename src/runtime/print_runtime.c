@@ -0,0 +1,440 @@
+/* mathc print runtime, linked into every program that prints.
+
+   Prebuilt by build.sh into src/print_runtime_objects.cpp, once per print format (MATHC_SHORTEST), as an object
+   that needs nothing from libc or libgcc: it makes the write(2) system call itself and does its 128-bit arithmetic
+   with the 64-bit mul and div instructions.
+
+   Every value is converted exactly: x = m * 2^e is scaled by a power of ten to an integer with the wanted number of
+   digits plus a remainder, which decides the rounding (ties to even, like glibc). Scales up to 10^±27 are done in
+   128-bit arithmetic; the rest (values below about 1e-13 or above 1e42) fall back to arbitrary-precision integers. */
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum {
+    MATHC_BUFFER_SIZE = 1 << 16,
+    MATHC_MAX_LINE    = 32,  /* "-1.2345678901234567e-308\n" fits */
+    MATHC_BIG_LIMBS   = 48,  /* m * 2^1074 * 10^340 needs 38 */
+};
+
+enum {
+    MATHC_SYS_WRITE = 1,
+    MATHC_EINTR     = 4,
+};
+
+typedef struct {
+    uint64_t high;
+    uint64_t low;
+} mathc_u128;
+
+static char mathc_buffer[MATHC_BUFFER_SIZE];
+static size_t mathc_length;
+
+static const uint64_t mathc_pow5[28] = {
+    1ull, 5ull, 25ull, 125ull, 625ull, 3125ull, 15625ull, 78125ull, 390625ull, 1953125ull, 9765625ull,
+    48828125ull, 244140625ull, 1220703125ull, 6103515625ull, 30517578125ull, 152587890625ull, 762939453125ull,
+    3814697265625ull, 19073486328125ull, 95367431640625ull, 476837158203125ull, 2384185791015625ull,
+    11920928955078125ull, 59604644775390625ull, 298023223876953125ull, 1490116119384765625ull,
+    7450580596923828125ull,
+};
+
+static const uint64_t mathc_pow10[18] = {
+    1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+    10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull,
+    1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+};
+
+/* write(2) to stdout, returning the number of bytes written or -errno */
+static long mathc_write(const char* data, size_t size) {
+    long result;
+    __asm__ volatile("syscall"
+                     : "=a"(result)
+                     : "a"((long)MATHC_SYS_WRITE), "D"(1L), "S"(data), "d"(size)
+                     : "rcx", "r11", "memory");
+    return result;
+}
+
+/* a * b */
+static mathc_u128 mul_u128(uint64_t a, uint64_t b) {
+    mathc_u128 product;
+    __asm__("mulq %3" : "=a"(product.low), "=d"(product.high) : "a"(a), "rm"(b) : "cc");
+    return product;
+}
+
+/* n / d, which must fit in 64 bits (n.high < d), with the remainder in *rest */
+static uint64_t div_u128(mathc_u128 n, uint64_t d, uint64_t* rest) {
+    uint64_t quotient;
+    __asm__("divq %4" : "=a"(quotient), "=d"(*rest) : "a"(n.low), "d"(n.high), "rm"(d) : "cc");
+    return quotient;
+}
+
+static mathc_u128 shl_u128(mathc_u128 n, int bits) {
+    if (bits >= 64) {
+        return (mathc_u128){n.low << (bits - 64), 0};
+    }
+    if (bits == 0) {
+        return n;
+    }
+    return (mathc_u128){n.high << bits | n.low >> (64 - bits), n.low << bits};
+}
+
+static mathc_u128 shr_u128(mathc_u128 n, int bits) {
+    if (bits >= 64) {
+        return (mathc_u128){0, n.high >> (bits - 64)};
+    }
+    if (bits == 0) {
+        return n;
+    }
+    return (mathc_u128){n.high >> bits, n.low >> bits | n.high << (64 - bits)};
+}
+
+/* The low `bits` bits of n */
+static mathc_u128 low_u128(mathc_u128 n, int bits) {
+    if (bits >= 64) {
+        return (mathc_u128){bits == 64 ? 0 : n.high & (((uint64_t)1 << (bits - 64)) - 1), n.low};
+    }
+    return (mathc_u128){0, n.low & (((uint64_t)1 << bits) - 1)};
+}
+
+void mathc_flush(void) {
+    size_t done = 0;
+    while (done < mathc_length) {
+        const long written = mathc_write(mathc_buffer + done, mathc_length - done);
+        if (written < 0) {
+            if (written == -MATHC_EINTR) {
+                continue;
+            }
+            break;
+        }
+        done += (size_t)written;
+    }
+    mathc_length = 0;
+}
+
+/* Unsigned integer, least significant limb first, no leading zero limbs */
+typedef struct {
+    uint32_t limb[MATHC_BIG_LIMBS];
+    int size;
+} mathc_big;
+
+static void big_set(mathc_big* b, uint64_t value) {
+    b->size = 0;
+    for (; value != 0; value >>= 32) {
+        b->limb[b->size++] = (uint32_t)value;
+    }
+}
+
+static void big_mul(mathc_big* b, uint64_t factor) {
+    /* limb * factor + carry < 2^96, so the carry out of each limb fits in 64 bits */
+    uint64_t carry = 0;
+    for (int i = 0; i < b->size; ++i) {
+        mathc_u128 product = mul_u128(b->limb[i], factor);
+        product.low += carry;
+        product.high += product.low < carry;
+        b->limb[i] = (uint32_t)product.low;
+        carry      = product.high << 32 | product.low >> 32;
+    }
+    for (; carry != 0; carry >>= 32) {
+        b->limb[b->size++] = (uint32_t)carry;
+    }
+}
+
+static void big_shl(mathc_big* b, int bits) {
+    if (b->size == 0) {
+        return;
+    }
+    const int words = bits / 32;
+    const int shift = bits % 32;
+    const uint32_t top = shift != 0 ? b->limb[b->size - 1] >> (32 - shift) : 0;
+    for (int i = b->size - 1; i >= 0; --i) {
+        const uint32_t low = shift != 0 && i > 0 ? b->limb[i - 1] >> (32 - shift) : 0;
+        b->limb[i + words] = (b->limb[i] << shift) | low;
+    }
+    for (int i = 0; i < words; ++i) {
+        b->limb[i] = 0;
+    }
+    b->size += words;
+    if (top != 0) {
+        b->limb[b->size++] = top;
+    }
+}
+
+static void big_mul_pow10(mathc_big* b, int n) {
+    int fives = n;
+    for (; fives > 27; fives -= 27) {
+        big_mul(b, mathc_pow5[27]);
+    }
+    big_mul(b, mathc_pow5[fives]);
+    big_shl(b, n);
+}
+
+static int big_cmp(const mathc_big* a, const mathc_big* b) {
+    if (a->size != b->size) {
+        return a->size < b->size ? -1 : 1;
+    }
+    for (int i = a->size - 1; i >= 0; --i) {
+        if (a->limb[i] != b->limb[i]) {
+            return a->limb[i] < b->limb[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/* a -= b, with a >= b */
+static void big_sub(mathc_big* a, const mathc_big* b) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < a->size; ++i) {
+        const uint64_t diff = (uint64_t)a->limb[i] - (i < b->size ? b->limb[i] : 0) - borrow;
+        a->limb[i] = (uint32_t)diff;
+        borrow = diff >> 63;
+    }
+    while (a->size > 0 && a->limb[a->size - 1] == 0) {
+        --a->size;
+    }
+}
+
+static int big_bits(const mathc_big* b) {
+    return b->size == 0 ? 0 : b->size * 32 - __builtin_clz(b->limb[b->size - 1]);
+}
+
+/* Returns num / den, which must fit in 63 bits, and leaves the remainder in num */
+static uint64_t big_divmod(mathc_big* num, const mathc_big* den) {
+    uint64_t quotient = 0;
+    for (int shift = big_bits(num) - big_bits(den); shift >= 0; --shift) {
+        mathc_big part = *den;
+        big_shl(&part, shift);
+        if (big_cmp(num, &part) >= 0) {
+            big_sub(num, &part);
+            quotient |= (uint64_t)1 << shift;
+        }
+    }
+    return quotient;
+}
+
+/* num / den = m * 2^e * 10^s */
+static void big_scaled(uint64_t m, int e, int s, mathc_big* num, mathc_big* den) {
+    big_set(num, m);
+    big_set(den, 1);
+    big_shl(e > 0 ? num : den, e > 0 ? e : -e);
+    big_mul_pow10(s > 0 ? num : den, s > 0 ? s : -s);
+}
+
+static int compare_u128(mathc_u128 a, mathc_u128 b) {
+    if (a.high != b.high) {
+        return a.high < b.high ? -1 : 1;
+    }
+    return a.low < b.low ? -1 : a.low > b.low;
+}
+
+/* floor(m * 2^e * 10^s); *half says how the fraction dropped compares with one half (-1, 0 or 1) */
+static uint64_t mathc_scale(uint64_t m, int e, int s, int* half) {
+    const mathc_u128 one = {0, 1};
+    if (s >= 0 && s <= 27) {
+        /* m * 5^s < 2^116, shifted by e + s */
+        const mathc_u128 n = mul_u128(m, mathc_pow5[s]);
+        const int shift    = e + s;
+        if (shift >= 0 && shift < 64 && n.high == 0 && (shift == 0 || n.low >> (64 - shift) == 0)) {
+            *half = -1;
+            return n.low << shift;
+        }
+        if (shift < 0 && shift > -128 && shr_u128(n, -shift).high == 0) {
+            *half = compare_u128(low_u128(n, -shift), shl_u128(one, -shift - 1));
+            return shr_u128(n, -shift).low;
+        }
+    } else if (s < 0 && s >= -27) {
+        /* m * 2^(e + s) / 5^-s */
+        const int shift = e + s;
+        if (shift >= 0 && shift < 64) {
+            const mathc_u128 n = shl_u128((mathc_u128){0, m}, shift);
+            const uint64_t d   = mathc_pow5[-s];
+            if (n.high < d) {
+                uint64_t rest;
+                const uint64_t quotient = div_u128(n, d, &rest);
+                *half                   = rest < d - rest ? -1 : rest > d - rest; /* 2 * rest against d */
+                return quotient;
+            }
+        } else if (shift < 0 && shift > -64) {
+            /* 5^27 < 2^63, so d < 2^126 */
+            const mathc_u128 d = shl_u128((mathc_u128){0, mathc_pow5[-s]}, -shift);
+            if (d.high != 0) {
+                *half = compare_u128((mathc_u128){0, 2 * m}, d); /* m < 2^53 */
+                return 0;
+            }
+            *half = compare_u128((mathc_u128){0, 2 * (m % d.low)}, d);
+            return m / d.low;
+        }
+    }
+
+    mathc_big num;
+    mathc_big den;
+    big_scaled(m, e, s, &num, &den);
+    const uint64_t quotient = big_divmod(&num, &den);
+    big_shl(&num, 1);
+    *half = big_cmp(&num, &den);
+    return quotient;
+}
+
+/* Rounds m * 2^e to `precision` significant digits. Returns them as an integer and stores the decimal exponent of
+   the first one in *exponent. */
+static uint64_t mathc_round(uint64_t m, int e, int precision, int* exponent) {
+    const uint64_t low  = mathc_pow10[precision - 1];
+    const uint64_t high = mathc_pow10[precision];
+
+    /* floor(log10(2) * floor(log2(x))), off by at most one either way */
+    int k = ((e + 63 - __builtin_clzll(m)) * 78913) >> 18;
+    for (;;) {
+        int half;
+        uint64_t digits = mathc_scale(m, e, precision - 1 - k, &half);
+        if (digits >= high) {
+            ++k;
+            continue;
+        }
+        if (digits < low) {
+            --k;
+            continue;
+        }
+        if (half > 0 || (half == 0 && (digits & 1) != 0)) {
+            if (++digits == high) {
+                digits = low;
+                ++k;
+            }
+        }
+        *exponent = k;
+        return digits;
+    }
+}
+
+#if MATHC_SHORTEST
+/* Whether digits * 10^-s reads back as m * 2^e, i.e. lies within half the gap to either neighbouring double. Scaled
+   by 10^s, x is num / den and the half gap above it is x / 2m (below, x / 4m at the bottom of a binade). */
+static int mathc_round_trips(uint64_t m, int e, uint64_t digits, int s) {
+    mathc_big num;
+    mathc_big den;
+    big_scaled(m, e, s, &num, &den);
+    big_mul(&den, digits);
+
+    uint64_t gap = 2 * m;
+    if (big_cmp(&den, &num) >= 0) {
+        big_sub(&den, &num);
+    } else {
+        mathc_big diff = num;
+        big_sub(&diff, &den);
+        den = diff;
+        if (m == (uint64_t)1 << 52 && e > -1074) {
+            gap = 4 * m;
+        }
+    }
+    big_mul(&den, gap);
+
+    /* Reading back rounds a tie to the even significand */
+    const int c = big_cmp(&den, &num);
+    return c < 0 || (c == 0 && (m & 1) == 0);
+}
+#endif
+
+/* Writes `count` significant digits (no trailing zeros) whose first has decimal exponent `exponent` the way printf's
+   %g does with the given precision */
+static char* mathc_write_digits(char* out, const char* digits, int count, int exponent, int precision) {
+    if (exponent < -4 || exponent >= precision) {
+        *out++ = digits[0];
+        if (count > 1) {
+            *out++ = '.';
+            for (int i = 1; i < count; ++i) {
+                *out++ = digits[i];
+            }
+        }
+        *out++ = 'e';
+        *out++ = exponent < 0 ? '-' : '+';
+        int magnitude = exponent < 0 ? -exponent : exponent;
+        if (magnitude >= 100) {
+            *out++ = (char)('0' + magnitude / 100);
+            magnitude %= 100;
+        }
+        *out++ = (char)('0' + magnitude / 10);
+        *out++ = (char)('0' + magnitude % 10);
+    } else if (exponent >= 0) {
+        for (int i = 0; i <= exponent; ++i) {
+            *out++ = i < count ? digits[i] : '0';
+        }
+        if (count > exponent + 1) {
+            *out++ = '.';
+            for (int i = exponent + 1; i < count; ++i) {
+                *out++ = digits[i];
+            }
+        }
+    } else {
+        *out++ = '0';
+        *out++ = '.';
+        for (int i = -1; i > exponent; --i) {
+            *out++ = '0';
+        }
+        for (int i = 0; i < count; ++i) {
+            *out++ = digits[i];
+        }
+    }
+    return out;
+}
+
+static char* mathc_format(char* out, double value) {
+    union {
+        double value;
+        uint64_t bits;
+    } pun = {value};
+    const uint64_t fraction = pun.bits & (((uint64_t)1 << 52) - 1);
+    const int field         = (int)(pun.bits >> 52) & 0x7FF;
+
+    if (pun.bits >> 63) {
+        *out++ = '-';
+    }
+    if (field == 0x7FF) {
+        const char* text = fraction != 0 ? "nan" : "inf";
+        for (int i = 0; i < 3; ++i) {
+            *out++ = text[i];
+        }
+        return out;
+    }
+    if (field == 0 && fraction == 0) {
+        *out++ = '0';
+        return out;
+    }
+
+    const uint64_t m = field != 0 ? fraction | (uint64_t)1 << 52 : fraction;
+    const int e      = field != 0 ? field - 1075 : -1074;
+
+    int exponent;
+#if MATHC_SHORTEST
+    /* With a full significand, a representation of at most 15 digits that reads back is the value rounded to 15
+       digits; otherwise the 16-digit rounding is the closest 16-digit candidate, and 17 digits always read back.
+       Subnormals are too coarse for that shortcut and try every length. */
+    int precision = field != 0 ? 15 : 1;
+    uint64_t q    = mathc_round(m, e, precision, &exponent);
+    while (precision < 17 && !mathc_round_trips(m, e, q, precision - 1 - exponent)) {
+        ++precision;
+        q = mathc_round(m, e, precision, &exponent);
+    }
+    const int layout = 17;
+#else
+    const int precision = 15;
+    uint64_t q          = mathc_round(m, e, precision, &exponent);
+    const int layout    = 15;
+#endif
+
+    char digits[17];
+    for (int i = precision; i-- > 0; q /= 10) {
+        digits[i] = (char)('0' + q % 10);
+    }
+    int count = precision;
+    while (count > 1 && digits[count - 1] == '0') {
+        --count;
+    }
+    return mathc_write_digits(out, digits, count, exponent, layout);
+}
+
+void mathc_print(double value) {
+    if (mathc_length > MATHC_BUFFER_SIZE - MATHC_MAX_LINE) {
+        mathc_flush();
+    }
+    char* end    = mathc_format(mathc_buffer + mathc_length, value);
+    *end++       = '\n';
+    mathc_length = (size_t)(end - mathc_buffer);
+}
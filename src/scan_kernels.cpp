@@ -0,0 +1,213 @@
+#include "scan_kernels.hpp"
+
+#if defined(__x86_64__)
+    #include <immintrin.h>
+    #define MATHC_SCAN_X86 1
+#endif
+
+namespace mathc {
+    namespace {
+        using kernel_fn = size_t (*)(const char* data, size_t size, size_t pos);
+
+        struct kernel_table {
+            kernel_fn skip_whitespace;
+            kernel_fn find_newline;
+            kernel_fn skip_digits;
+            kernel_fn skip_identifier;
+        };
+
+        // Scalar byte classes. These define the token grammar; the vector classifiers below mirror them exactly.
+        bool is_space(char c) {
+            return c <= ' ';
+        }
+
+        bool is_not_newline(char c) {
+            return c != '\n';
+        }
+
+        bool is_digit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        bool is_ident(char c) {
+            const char lower = CAST<char>(c | 0x20);
+            return is_digit(c) || (lower >= 'a' && lower <= 'z') || c == '_';
+        }
+
+        template<bool (*Pred)(char)>
+        size_t scalar_skip(const char* data, size_t size, size_t pos) {
+            while (pos < size && Pred(data[pos])) {
+                ++pos;
+            }
+            return pos;
+        }
+
+        constexpr kernel_table scalar_kernels = {
+          scalar_skip<is_space>,
+          scalar_skip<is_not_newline>,
+          scalar_skip<is_digit>,
+          scalar_skip<is_ident>,
+        };
+
+#ifdef MATHC_SCAN_X86
+        // Each classifier returns a bit mask with one bit set per byte that ends the run
+
+        u32 sse2_stop_space(__m128i v) {
+            return ~CAST<u32>(_mm_movemask_epi8(_mm_cmplt_epi8(v, _mm_set1_epi8(' ' + 1)))) & 0xFFFFu;
+        }
+
+        u32 sse2_stop_newline(__m128i v) {
+            return CAST<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_set1_epi8('\n'))));
+        }
+
+        __m128i sse2_digit_mask(__m128i v) {
+            const __m128i t = _mm_sub_epi8(v, _mm_set1_epi8('0'));
+            return _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(9)), t);
+        }
+
+        u32 sse2_stop_digit(__m128i v) {
+            return ~CAST<u32>(_mm_movemask_epi8(sse2_digit_mask(v))) & 0xFFFFu;
+        }
+
+        u32 sse2_stop_ident(__m128i v) {
+            const __m128i lower = _mm_sub_epi8(_mm_or_si128(v, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+            const __m128i alpha = _mm_cmpeq_epi8(_mm_min_epu8(lower, _mm_set1_epi8(25)), lower);
+            const __m128i under = _mm_cmpeq_epi8(v, _mm_set1_epi8('_'));
+            const __m128i ident = _mm_or_si128(_mm_or_si128(alpha, under), sse2_digit_mask(v));
+            return ~CAST<u32>(_mm_movemask_epi8(ident)) & 0xFFFFu;
+        }
+
+        template<u32 (*Stop)(__m128i), bool (*Pred)(char)>
+        size_t sse2_skip(const char* data, size_t size, size_t pos) {
+            while (pos + 16 <= size) {
+                const u32 stop = Stop(_mm_loadu_si128(RCAST<const __m128i*>(data + pos)));
+                if (stop != 0) {
+                    return pos + CAST<size_t>(__builtin_ctz(stop));
+                }
+                pos += 16;
+            }
+            return scalar_skip<Pred>(data, size, pos);
+        }
+
+        constexpr kernel_table sse2_kernels = {
+          sse2_skip<sse2_stop_space, is_space>,
+          sse2_skip<sse2_stop_newline, is_not_newline>,
+          sse2_skip<sse2_stop_digit, is_digit>,
+          sse2_skip<sse2_stop_ident, is_ident>,
+        };
+
+    #define MATHC_AVX2 __attribute__((target("avx2")))
+
+        MATHC_AVX2 u32 avx2_stop_space(__m256i v) {
+            return ~CAST<u32>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(' ' + 1), v)));
+        }
+
+        MATHC_AVX2 u32 avx2_stop_newline(__m256i v) {
+            return CAST<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('\n'))));
+        }
+
+        MATHC_AVX2 __m256i avx2_digit_mask(__m256i v) {
+            const __m256i t = _mm256_sub_epi8(v, _mm256_set1_epi8('0'));
+            return _mm256_cmpeq_epi8(_mm256_min_epu8(t, _mm256_set1_epi8(9)), t);
+        }
+
+        MATHC_AVX2 u32 avx2_stop_digit(__m256i v) {
+            return ~CAST<u32>(_mm256_movemask_epi8(avx2_digit_mask(v)));
+        }
+
+        MATHC_AVX2 u32 avx2_stop_ident(__m256i v) {
+            const __m256i lower = _mm256_sub_epi8(_mm256_or_si256(v, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+            const __m256i alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(lower, _mm256_set1_epi8(25)), lower);
+            const __m256i under = _mm256_cmpeq_epi8(v, _mm256_set1_epi8('_'));
+            const __m256i ident = _mm256_or_si256(_mm256_or_si256(alpha, under), avx2_digit_mask(v));
+            return ~CAST<u32>(_mm256_movemask_epi8(ident));
+        }
+
+        template<u32 (*Stop)(__m256i), bool (*Pred)(char)>
+        MATHC_AVX2 size_t avx2_skip(const char* data, size_t size, size_t pos) {
+            while (pos + 32 <= size) {
+                const u32 stop = Stop(_mm256_loadu_si256(RCAST<const __m256i*>(data + pos)));
+                if (stop != 0) {
+                    return pos + CAST<size_t>(__builtin_ctz(stop));
+                }
+                pos += 32;
+            }
+            return scalar_skip<Pred>(data, size, pos);
+        }
+
+        constexpr kernel_table avx2_kernels = {
+          avx2_skip<avx2_stop_space, is_space>,
+          avx2_skip<avx2_stop_newline, is_not_newline>,
+          avx2_skip<avx2_stop_digit, is_digit>,
+          avx2_skip<avx2_stop_ident, is_ident>,
+        };
+
+    #undef MATHC_AVX2
+#endif
+
+        const kernel_table* table_for(scan_isa isa) {
+            switch (isa) {
+#ifdef MATHC_SCAN_X86
+                case scan_isa::ISA_AVX2:
+                    return &avx2_kernels;
+                case scan_isa::ISA_SSE2:
+                    return &sse2_kernels;
+#endif
+                default:
+                    return &scalar_kernels;
+            }
+        }
+
+        scan_isa active_isa = scan_kernels::best_supported_isa();
+        const kernel_table* active_kernels = table_for(active_isa);
+    }  // namespace
+
+    size_t scan_kernels::skip_whitespace(std::string_view src, size_t pos) {
+        return active_kernels->skip_whitespace(src.data(), src.size(), pos);
+    }
+
+    size_t scan_kernels::find_newline(std::string_view src, size_t pos) {
+        return active_kernels->find_newline(src.data(), src.size(), pos);
+    }
+
+    size_t scan_kernels::skip_digits(std::string_view src, size_t pos) {
+        return active_kernels->skip_digits(src.data(), src.size(), pos);
+    }
+
+    size_t scan_kernels::skip_identifier(std::string_view src, size_t pos) {
+        return active_kernels->skip_identifier(src.data(), src.size(), pos);
+    }
+
+    void scan_kernels::set_isa(scan_isa isa) {
+        active_isa     = CAST<i32>(isa) > CAST<i32>(best_supported_isa()) ? best_supported_isa() : isa;
+        active_kernels = table_for(active_isa);
+    }
+
+    scan_isa scan_kernels::get_isa() {
+        return active_isa;
+    }
+
+    scan_isa scan_kernels::best_supported_isa() {
+#ifdef MATHC_SCAN_X86
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return scan_isa::ISA_AVX2;
+        }
+        return scan_isa::ISA_SSE2;
+#else
+        return scan_isa::ISA_SCALAR;
+#endif
+    }
+
+    const char* scan_kernels::isa_name(scan_isa isa) {
+        switch (isa) {
+            case scan_isa::ISA_SCALAR:
+                return "scalar";
+            case scan_isa::ISA_SSE2:
+                return "sse2";
+            case scan_isa::ISA_AVX2:
+                return "avx2";
+        }
+        return "";
+    }
+}  // namespace mathc
@@ -0,0 +1,41 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include <string_view>
+
+namespace mathc {
+    /// @brief Instruction set used by the scanning kernels
+    enum class scan_isa {
+        ISA_SCALAR,
+        ISA_SSE2,  // 16 bytes per step, always available on x86-64
+        ISA_AVX2,  // 32 bytes per step, selected at runtime via cpuid
+    };
+
+    /// @brief Byte-class search routines used by `token_scanner`.
+    ///
+    /// Each routine starts at `pos` and returns the index of the first byte that does *not* belong to the class it
+    /// skips (or `src.size()` if the run reaches the end of the input). The vector implementations classify a whole
+    /// block per step and never read past `src.size()`; the scalar implementation is the reference they must agree
+    /// with.
+    class scan_kernels {
+    public:
+        /// Skips bytes the scanner treats as whitespace (any signed `char` <= ' ')
+        static size_t skip_whitespace(std::string_view src, size_t pos);
+
+        /// Returns the index of the next '\n'
+        static size_t find_newline(std::string_view src, size_t pos);
+
+        /// Skips decimal digits
+        static size_t skip_digits(std::string_view src, size_t pos);
+
+        /// Skips identifier characters ([0-9A-Za-z_])
+        static size_t skip_identifier(std::string_view src, size_t pos);
+
+        /// Selects the kernels to use. Requests for an ISA the CPU lacks fall back to the best supported one.
+        static void set_isa(scan_isa isa);
+
+        [[nodiscard]] static scan_isa get_isa();
+        [[nodiscard]] static scan_isa best_supported_isa();
+        [[nodiscard]] static const char* isa_name(scan_isa isa);
+    };
+}  // namespace mathc
@@ -1,27 +1,54 @@
 #include "scanner.hpp"
-#include <algorithm>
+#include "scan_kernels.hpp"
+#include "float_parser.hpp"
 #include <cctype>
-#include <cstdlib>
+#include <limits>
+#include <sstream>
 
 namespace mathc {
-    token token_scanner::emit() {
-        if (pos_ >= source_.length() - 1) {
-            return token(token_type::TOKEN_EOF);
+    token_stream token_scanner::scan_all() {
+        if (source_.size() > std::numeric_limits<u32>::max()) {
+            throw scan_error("source file is too large (maximum is 4 GiB)");
         }
 
-        char c = current();
+        tokens_ = token_stream(source_);
+        tokens_.index_lines();
 
-        // skip whitespace
-        while (is_whitespace(c)) {
-            c = advance();
+        while (scan_token()) {}
+
+        return std::move(tokens_);
+    }
+
+    token_stream token_scanner::scan_until(u64 begin, const std::function<bool(u64)>& resync, u64& stop) {
+        if (source_.size() > std::numeric_limits<u32>::max()) {
+            throw scan_error("source file is too large (maximum is 4 GiB)");
         }
 
-        // skip comments
-        if (c == '#') {
-            skip_comment();
-            c = current();
+        tokens_ = token_stream(source_);
+        tokens_.index_lines();
+        pos_ = begin;
+
+        while (true) {
+            skip_trivia();
+            if (pos_ >= source_.size() || resync(pos_)) {
+                break;
+            }
+            scan_token();
         }
 
+        stop = pos_;
+        return std::move(tokens_);
+    }
+
+    bool token_scanner::scan_token() {
+        skip_trivia();
+
+        if (pos_ >= source_.size()) {
+            tokens_.push(token_type::TOKEN_EOF, CAST<u32>(source_.size()));
+            return false;
+        }
+
+        const char c    = current();
         auto curr_pos   = pos_;
         token_type type = token_type::TOKEN_INVALID;
         switch (c) {
@@ -34,6 +61,9 @@ namespace mathc {
             case '*':
                 type = token_type::TOKEN_MULTIPLY;
                 break;
+            case '%':
+                type = token_type::TOKEN_MODULO;
+                break;
             case '/': {
                 if (peek() == '/') {
                     ++pos_;
@@ -54,139 +84,97 @@ namespace mathc {
             case '=':
                 type = token_type::TOKEN_ASSIGNMENT;
                 break;
-            case EOF:
-                type = token_type::TOKEN_EOF;
-                break;
             default:
                 if (std::isdigit(c)) {
-                    return parse_number();
+                    parse_number();
+                    return true;
                 }
 
                 if (std::isalnum(c)) {
-                    return parse_identifier();
+                    parse_identifier();
+                    return true;
                 }
 
                 std::ostringstream oss;
                 oss << "invalid token: '";
-                oss << c << "' [0x" << (i32)c << "]\n";
+                oss << c << "' [0x" << (i32)c << "] at " << describe_position(pos_);
                 throw scan_error(oss.str());
         }
 
         ++pos_;  // increment position;
 
-        token out(type);
-        out.line   = 1;  // for now this will always be true
-        out.column = curr_pos;
-
-        return out;
+        tokens_.push(type, CAST<u32>(curr_pos));
+        return true;
     }
 
-    char token_scanner::current() {
-        return source_.at(pos_);
-    }
-
-    char token_scanner::advance() {
-        if (pos_ + 1 > source_.length()) {
-            throw scan_error("tried to advance past source length");
-        }
-
-        return source_.at(++pos_);
+    char token_scanner::current() const {
+        return pos_ < source_.size() ? source_[pos_] : '\0';
     }
 
-    char token_scanner::peek() {
-        if (pos_ + 1 > source_.length()) {
-            throw scan_error("tried to advance past source length");
-        }
-
-        return source_.at(pos_ + 1);
+    char token_scanner::peek() const {
+        return pos_ + 1 < source_.size() ? source_[pos_ + 1] : '\0';
     }
 
-    token token_scanner::parse_number() {
-        constexpr size_t max_number_len = 64;
-        auto start_pos                  = pos_;
-        i32 buffer_pos                  = 0;
-        char buffer[max_number_len]     = {'\0'};
-
-        while (pos_ < source_.size()) {
-            char c = current();
-
-            if (!std::isdigit(c) && c != '.') {
-                break;
-            }
+    void token_scanner::parse_number() {
+        const auto start_pos = pos_;
 
-            if ((size_t)buffer_pos >= max_number_len) {
-                throw scan_error("number value contains too many digits (maximum is 64)");
+        f64 value;
+        if (!float_parser::parse(source_, pos_, value)) {
+            // Report the whole malformed run, e.g. `1.2.3` rather than just `1.2`
+            auto end = pos_;
+            while (end < source_.size() && (std::isalnum(CAST<u8>(source_[end])) || source_[end] == '.' ||
+                                            source_[end] == '_')) {
+                ++end;
             }
 
-            buffer[buffer_pos++] = c;
-            ++pos_;
+            std::ostringstream oss;
+            oss << "malformed number literal '" << source_.substr(start_pos, end - start_pos) << "' at "
+                << describe_position(pos_);
+            throw scan_error(oss.str());
         }
 
-        char* endptr;
-        f64 value = std::strtod(buffer, &endptr);
-        token out(token_type::TOKEN_NUMBER, value);
-        out.line   = 1;
-        out.column = start_pos;
-
-        return out;
+        tokens_.push_number(CAST<u32>(start_pos), value);
     }
 
-    token token_scanner::parse_identifier() {
+    void token_scanner::parse_identifier() {
         // Identifiers can contain letters, numbers, and underscores
         // They cannot begin with a number of underscore
         // They can have a maximum length of 64 characters;
         constexpr size_t max_ident_len = 64;
-        char buffer[max_ident_len]     = {'\0'};
-        i32 buffer_pos                 = 0;
         auto start_pos                 = pos_;
 
-        while (pos_ < source_.size()) {
-            char c = current();
-
-            if (!std::isalnum(c) && c != '_') {
-                break;
-            }
-
-            if ((size_t)buffer_pos >= max_ident_len) {
-                throw scan_error("identifier contains too many characters (maximum is 64)");
-            }
-
-            buffer[buffer_pos++] = c;
-            ++pos_;
+        pos_ = scan_kernels::skip_identifier(source_, pos_);
+        if (pos_ - start_pos > max_ident_len) {
+            throw scan_error("identifier contains too many characters (maximum is 64) at " +
+                             describe_position(start_pos));
         }
 
-        string identifier = string(buffer);
-        token_type type   = is_keyword(identifier) ? token_type::TOKEN_KEYWORD : token_type::TOKEN_IDENTIFIER;
-        token out(type, identifier);
-        out.line   = 1;
-        out.column = start_pos;
+        const std::string_view identifier = source_.substr(start_pos, pos_ - start_pos);
+        if (const auto kw = symbol_table::find_keyword(identifier)) {
+            tokens_.push_keyword(CAST<u32>(start_pos), *kw);
+            return;
+        }
 
-        return out;
+        tokens_.push_identifier(CAST<u32>(start_pos), symbol_table::global().intern(identifier));
     }
 
-    bool token_scanner::is_whitespace(char c) {
-        return c <= ' ';
+    void token_scanner::skip_trivia() {
+        pos_ = scan_kernels::skip_whitespace(source_, pos_);
+        while (current() == '#') {
+            skip_comment();
+            pos_ = scan_kernels::skip_whitespace(source_, pos_);
+        }
     }
 
     void token_scanner::skip_comment() {
-        char c = advance();
-        while (c != '\n' && c != EOF) {
-            c = advance();
-        }
-        if (c == '\n') {
-            ++pos_;
+        pos_ = scan_kernels::find_newline(source_, pos_);
+        if (pos_ < source_.size()) {
+            ++pos_;  // consume '\n'
         }
     }
 
-    bool token_scanner::is_keyword(const string& identifier) {
-        // For now I'm just defining keywords here.
-        // As this grows more complex, I'll need to refactor this
-        // but it'll work for now
-
-        const array<string, 1> keywords = {"print"};
-        const bool contains =
-          std::ranges::any_of(keywords, [&identifier](const string& keyword) { return keyword == identifier; });
-
-        return contains;
+    string token_scanner::describe_position(u64 pos) const {
+        const auto [line, column] = tokens_.locate(CAST<u32>(pos));
+        return "line " + std::to_string(line) + ", column " + std::to_string(column);
     }
 }  // namespace mathc
@@ -1,98 +1,12 @@
 #pragma once
 
 #include "mathc_common.hpp"
+#include "token_stream.hpp"
 #include <stdexcept>
-#include <variant>
-#include <iostream>
+#include <functional>
+#include <string_view>
 
 namespace mathc {
-    enum class token_type {
-        TOKEN_ADD,          // '+'
-        TOKEN_SUBTRACT,     // '-'
-        TOKEN_MULTIPLY,     // '*'
-        TOKEN_DIVIDE,       // '/'
-        TOKEN_MODULO,       // '%'
-        TOKEN_FLOOR_DIV,    // '//'
-        TOKEN_LEFT_PAREN,   // '('
-        TOKEN_RIGHT_PAREN,  // ')'
-        TOKEN_SEMICOLON,    // ';'
-        TOKEN_NUMBER,       // '134.34'
-        TOKEN_IDENTIFIER,   // 'x', 'my_num'
-        TOKEN_ASSIGNMENT,   // '='
-        TOKEN_KEYWORD,      // 'print', 'if', 'fn'
-        TOKEN_INVALID,
-        TOKEN_EOF,
-    };
-
-    using token_value = std::variant<std::monostate, f64, string>;
-
-    struct token {
-        token_type type;
-        token_value value;
-        size_t line;
-        size_t column;
-
-        token() : type(token_type::TOKEN_INVALID), value(std::monostate {}) {}
-
-        token(token_type t) : type(t), value(std::monostate {}) {}
-
-        template<typename T>
-        token(token_type t, T value) : type(t), value(std::move(value)) {}
-
-        friend std::ostream& operator<<(std::ostream& stream, const token& tok) {
-            const auto token_name = token_type_to_str(tok.type);
-            stream << token_name;
-            if (tok.type == token_type::TOKEN_NUMBER) {
-                stream << " (" << std::get<f64>(tok.value) << ")";
-            }
-            if (tok.type == token_type::TOKEN_IDENTIFIER) {
-                stream << " ('" << std::get<string>(tok.value) << "')";
-            }
-            if (tok.type == token_type::TOKEN_KEYWORD) {
-                stream << " ('" << std::get<string>(tok.value) << "')";
-            }
-            stream << "\n";
-            return stream;
-        }
-
-        static string token_type_to_str(const token_type type) {
-            switch (type) {
-                case token_type::TOKEN_ADD:
-                    return "Add `+`";
-                case token_type::TOKEN_SUBTRACT:
-                    return "Subtract `-`";
-                case token_type::TOKEN_MULTIPLY:
-                    return "Multiply `*`";
-                case token_type::TOKEN_DIVIDE:
-                    return "Divide `/`";
-                case token_type::TOKEN_MODULO:
-                    return "Modulo `%`";
-                case token_type::TOKEN_FLOOR_DIV:
-                    return "Floor Division `//`";
-                case token_type::TOKEN_LEFT_PAREN:
-                    return "Left Paren `(`";
-                case token_type::TOKEN_RIGHT_PAREN:
-                    return "Right Paren `)`";
-                case token_type::TOKEN_SEMICOLON:
-                    return "Semicolon `(;)`";
-                case token_type::TOKEN_NUMBER:
-                    return "Number";
-                case token_type::TOKEN_INVALID:
-                    return "Invalid";
-                case token_type::TOKEN_IDENTIFIER:
-                    return "Identifier";
-                case token_type::TOKEN_ASSIGNMENT:
-                    return "Assignment `=`";
-                case token_type::TOKEN_KEYWORD:
-                    return "Keyword";
-                case token_type::TOKEN_EOF:
-                    return "EOF";
-            }
-
-            return "";
-        }
-    };
-
     class scan_error : public std::runtime_error {
     public:
         using std::runtime_error::runtime_error;
@@ -100,22 +14,30 @@ namespace mathc {
 
     class token_scanner {
     public:
-        token_scanner(string input) : source_(std::move(input)), pos_(0) {}
+        token_scanner(std::string_view input) : source_(input), pos_(0) {}
+
+        /// Lexes the whole input into a token stream terminated by `TOKEN_EOF`
+        token_stream scan_all();
 
-        token emit();
+        /// Lexes from byte `begin` (which must be the start of a token or trivia) up to the first token start for
+        /// which `resync` returns true, or to the end of the input. Returns the tokens before that point, without an
+        /// EOF token, and stores the byte offset where lexing stopped in `stop`.
+        token_stream scan_until(u64 begin, const std::function<bool(u64)>& resync, u64& stop);
 
     private:
-        string source_;
+        std::string_view source_;
         u64 pos_;
+        token_stream tokens_;
+
+        bool scan_token();
 
-        char current();
-        char advance();
-        char peek();
+        [[nodiscard]] char current() const;
+        [[nodiscard]] char peek() const;
 
-        token parse_number();
-        token parse_identifier();
+        void parse_number();
+        void parse_identifier();
+        void skip_trivia();
         void skip_comment();
-        static bool is_whitespace(char c);
-        static bool is_keyword(const string& identifier);
+        [[nodiscard]] string describe_position(u64 pos) const;
     };
 }  // namespace mathc
@@ -1,36 +1,63 @@
 #include "source.hpp"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace mathc {
     void source_code::process_source(const path& filename) {
-        std::ifstream file(filename);
-        if (!file.is_open()) {
+        const i32 fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd == -1) {
             throw source_error("could not open file: '" + filename.string() + "'");
         }
 
-        std::ostringstream oss;
-        oss << file.rdbuf();
-        input_ = oss.str();
-        file.close();
+        struct stat st {};
+        if (fstat(fd, &st) == -1 || st.st_size <= 0) {
+            close(fd);
+            throw source_error("an unknown error occurred");
+        }
+
+        size_t size = CAST<size_t>(st.st_size);
+        void* data  = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);  // the mapping keeps its own reference to the file
+        if (data == MAP_FAILED) {
+            throw source_error("could not map file: '" + filename.string() + "'");
+        }
+
+        // The scanner walks the file front to back exactly once
+        madvise(data, size, MADV_SEQUENTIAL);
 
-        line_count_ = std::ranges::count_if(input_, [](const char& c) { return c == '\n' || c == EOF; });
+        const auto* chars = CAST<const char*>(data);
+        line_count_       = CAST<i32>(std::count(chars, chars + size, '\n'));
         if (line_count_ <= 0) {
+            munmap(data, size);
             throw source_error("an unknown error occurred");
         }
+
+        data_ = chars;
+        size_ = size;
     }
 
     i32 source_code::get_line_count() {
         return line_count_;
     }
 
-    [[nodiscard]] const string& source_code::get_str() const {
-        return input_;
+    [[nodiscard]] std::string_view source_code::get_str() const {
+        return {data_, size_};
     }
 
     [[nodiscard]] const path& source_code::get_filename() const {
         return filename_;
     }
 
-    source_code::source_code(const path& filename) : filename_(filename) {
+    source_code::source_code(const path& filename) : filename_(filename), data_(nullptr), size_(0), line_count_(0) {
         process_source(filename);
     }
+
+    source_code::~source_code() {
+        if (data_) {
+            munmap(CCAST<char*>(data_), size_);
+        }
+    }
 }  // namespace mathc
@@ -2,9 +2,8 @@
 
 #include "mathc_common.hpp"
 #include <algorithm>
-#include <fstream>
-#include <sstream>
 #include <stdexcept>
+#include <string_view>
 
 namespace mathc {
     class source_error : public std::runtime_error {
@@ -12,17 +11,26 @@ namespace mathc {
         using std::runtime_error::runtime_error;
     };
 
+    /// @brief Read-only, memory-mapped view of a source file.
+    ///
+    /// The mapping lives as long as the `source_code` object, so every `std::string_view` handed out by
+    /// `get_str()` (and every token or AST node that points into it) must not outlive it.
     class source_code {
     public:
         source_code(const path& filename);
+        ~source_code();
+
+        source_code(const source_code&)            = delete;
+        source_code& operator=(const source_code&) = delete;
 
         [[nodiscard]] const path& get_filename() const;
-        [[nodiscard]] const string& get_str() const;
+        [[nodiscard]] std::string_view get_str() const;
         i32 get_line_count();
 
     private:
-        const path& filename_;
-        string input_;
+        path filename_;
+        const char* data_;
+        size_t size_;
         i32 line_count_;
 
         void process_source(const path& filename);
@@ -0,0 +1,121 @@
+#include "symbol_table.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace mathc {
+    namespace {
+        constexpr array<std::string_view, 1> keyword_names = {"print"};
+
+        // Every keyword lands in its own bucket, so a lookup is one hash plus at most one comparison
+        constexpr size_t keyword_buckets = 8;
+
+        constexpr size_t keyword_hash(std::string_view name) {
+            return (name.size() * 3 + CAST<u8>(name.front())) & (keyword_buckets - 1);
+        }
+
+        constexpr array<i8, keyword_buckets> make_keyword_buckets() {
+            array<i8, keyword_buckets> buckets {};
+            buckets.fill(-1);
+            for (size_t i = 0; i < keyword_names.size(); ++i) {
+                buckets[keyword_hash(keyword_names[i])] = CAST<i8>(i);
+            }
+            return buckets;
+        }
+
+        constexpr bool keyword_hash_is_perfect() {
+            const auto buckets = make_keyword_buckets();
+            return CAST<size_t>(std::ranges::count_if(buckets, [](i8 b) { return b >= 0; })) == keyword_names.size();
+        }
+
+        static_assert(keyword_hash_is_perfect(), "keyword_hash collides; adjust it when adding keywords");
+
+        constexpr auto keyword_bucket_table = make_keyword_buckets();
+    }  // namespace
+
+    symbol_table& symbol_table::global() {
+        static symbol_table table;
+        return table;
+    }
+
+    symbol_id symbol_table::intern(std::string_view name) {
+        if ((names_.size() + 1) * 2 > slots_.size()) {
+            grow();
+        }
+
+        const u64 h       = hash(name);
+        const size_t mask = slots_.size() - 1;
+        for (size_t i = h & mask;; i = (i + 1) & mask) {
+            const u32 slot = slots_[i];
+            if (slot == 0) {
+                const auto id = CAST<symbol_id>(names_.size());
+                names_.push_back(store(name));
+                hashes_.push_back(h);
+                slots_[i] = id + 1;
+                return id;
+            }
+            if (hashes_[slot - 1] == h && names_[slot - 1] == name) {
+                return slot - 1;
+            }
+        }
+    }
+
+    optional<keyword> symbol_table::find_keyword(std::string_view name) {
+        if (name.empty()) {
+            return std::nullopt;
+        }
+
+        const i8 index = keyword_bucket_table[keyword_hash(name)];
+        if (index < 0 || keyword_names[index] != name) {
+            return std::nullopt;
+        }
+        return CAST<keyword>(index);
+    }
+
+    std::string_view symbol_table::keyword_name(keyword kw) {
+        return keyword_names[CAST<size_t>(kw)];
+    }
+
+    std::string_view symbol_table::store(std::string_view name) {
+        if (chunk_used_ + name.size() > chunk_size) {
+            chunks_.push_back(std::make_unique<char[]>(std::max(chunk_size, name.size())));
+            chunk_used_ = 0;
+        }
+
+        char* dst = chunks_.back().get() + chunk_used_;
+        std::memcpy(dst, name.data(), name.size());
+        chunk_used_ += name.size();
+        return {dst, name.size()};
+    }
+
+    void symbol_table::grow() {
+        slots_.assign(std::max<size_t>(64, slots_.size() * 2), 0);
+
+        const size_t mask = slots_.size() - 1;
+        for (size_t id = 0; id < names_.size(); ++id) {
+            size_t i = hashes_[id] & mask;
+            while (slots_[i] != 0) {
+                i = (i + 1) & mask;
+            }
+            slots_[i] = CAST<u32>(id + 1);
+        }
+    }
+
+    u64 symbol_table::hash(std::string_view name) {
+        // Identifiers are at most 64 bytes: mix eight bytes per step, then the tail
+        constexpr u64 k = 0x9E3779B97F4A7C15;
+        u64 h           = name.size() * k;
+        size_t i        = 0;
+        for (; i + 8 <= name.size(); i += 8) {
+            u64 word;
+            std::memcpy(&word, name.data() + i, sizeof(word));
+            h = (h ^ word) * k;
+            h ^= h >> 29;
+        }
+
+        u64 tail = 0;
+        std::memcpy(&tail, name.data() + i, name.size() - i);
+        h = (h ^ tail) * k;
+        return h ^ (h >> 32);
+    }
+}  // namespace mathc
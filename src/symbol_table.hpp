@@ -0,0 +1,53 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include <string_view>
+
+namespace mathc {
+    /// @brief Dense identifier for an interned name; ids are assigned 0, 1, 2, ... in order of first appearance
+    using symbol_id = u32;
+
+    /// @brief Reserved words. Keywords are never interned; their tokens carry this value instead of a symbol id.
+    enum class keyword : u8 {
+        KW_PRINT,
+    };
+
+    /// @brief Process-wide identifier interner.
+    ///
+    /// Maps every distinct name to a dense `symbol_id` so later stages can index flat arrays instead of hashing
+    /// strings. Names are copied into large chunks owned by the table, so ids stay valid even after the source
+    /// buffer they were scanned from is gone.
+    class symbol_table {
+    public:
+        static symbol_table& global();
+
+        /// Returns the id of `name`, assigning the next free id if it has not been seen before
+        symbol_id intern(std::string_view name);
+
+        [[nodiscard]] std::string_view name(symbol_id id) const {
+            return names_[id];
+        }
+
+        [[nodiscard]] size_t size() const {
+            return names_.size();
+        }
+
+        /// Perfect-hash lookup of a reserved word
+        static optional<keyword> find_keyword(std::string_view name);
+
+        [[nodiscard]] static std::string_view keyword_name(keyword kw);
+
+    private:
+        static constexpr size_t chunk_size = 64 * 1024;
+
+        vector<u32> slots_;  // open-addressing table of (symbol id + 1), 0 marks an empty slot
+        vector<u64> hashes_;
+        vector<std::string_view> names_;
+        vector<unique_ptr<char[]>> chunks_;
+        size_t chunk_used_ = chunk_size;
+
+        std::string_view store(std::string_view name);
+        void grow();
+        static u64 hash(std::string_view name);
+    };
+}  // namespace mathc
@@ -0,0 +1,81 @@
+#include "target.hpp"
+
+#include <cpuid.h>
+
+namespace mathc {
+    namespace {
+        bool has_all(u32 reg, u32 bits) {
+            return (reg & bits) == bits;
+        }
+
+        // XCR0: which register states the OS saves on a context switch
+        u64 read_xcr0() {
+            u32 low  = 0;
+            u32 high = 0;
+            __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+            return (CAST<u64>(high) << 32) | low;
+        }
+    }  // namespace
+
+    optional<target_arch> target_info::parse(std::string_view name) {
+        if (name == "x86-64") {
+            return target_arch::ARCH_X86_64;
+        }
+        if (name == "x86-64-v2") {
+            return target_arch::ARCH_X86_64_V2;
+        }
+        if (name == "x86-64-v3") {
+            return target_arch::ARCH_X86_64_V3;
+        }
+        if (name == "native") {
+            return detect_native();
+        }
+        return std::nullopt;
+    }
+
+    target_arch target_info::detect_native() {
+        u32 eax = 0;
+        u32 ebx = 0;
+        u32 ecx = 0;
+        u32 edx = 0;
+        if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+            return target_arch::ARCH_X86_64;
+        }
+        const u32 basic_ecx = ecx;
+
+        u32 extended_ecx = 0;
+        if (__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx)) {
+            extended_ecx = ecx;
+        }
+
+        const bool v2 = has_all(basic_ecx, bit_SSE3 | bit_SSSE3 | bit_CMPXCHG16B | bit_SSE4_1 | bit_SSE4_2 |
+                                               bit_POPCNT) &&
+                        has_all(extended_ecx, bit_LAHF_LM);
+        if (!v2) {
+            return target_arch::ARCH_X86_64;
+        }
+
+        u32 structured_ebx = 0;
+        if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) {
+            structured_ebx = ebx;
+        }
+
+        // AVX instructions fault unless the OS has enabled saving the xmm and ymm state
+        const bool os_saves_avx = has_all(basic_ecx, bit_OSXSAVE) && (read_xcr0() & 0x6) == 0x6;
+        const bool v3           = os_saves_avx && has_all(basic_ecx, bit_AVX | bit_FMA | bit_F16C | bit_MOVBE) &&
+                        has_all(structured_ebx, bit_AVX2 | bit_BMI | bit_BMI2) && has_all(extended_ecx, bit_LZCNT);
+        return v3 ? target_arch::ARCH_X86_64_V3 : target_arch::ARCH_X86_64_V2;
+    }
+
+    const char* target_info::name(target_arch arch) {
+        switch (arch) {
+            case target_arch::ARCH_X86_64:
+                return "x86-64";
+            case target_arch::ARCH_X86_64_V2:
+                return "x86-64-v2";
+            case target_arch::ARCH_X86_64_V3:
+                return "x86-64-v3";
+        }
+        return "x86-64";
+    }
+}  // namespace mathc
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "options.hpp"
+
+#include <string_view>
+
+namespace mathc {
+    /// @brief What each `target_arch` level provides, and which level the host CPU supports
+    class target_info {
+    public:
+        /// Parses a `--march` value: "x86-64", "x86-64-v2", "x86-64-v3", or "native" for the host's level
+        static optional<target_arch> parse(std::string_view name);
+
+        /// Highest level whose instructions cpuid reports, and whose registers the OS saves
+        static target_arch detect_native();
+
+        /// The level's name, as gcc's `-march` spells it
+        static const char* name(target_arch arch);
+
+        /// SSE4.1 `roundsd`/`roundpd`
+        static constexpr bool has_round(target_arch arch) {
+            return arch >= target_arch::ARCH_X86_64_V2;
+        }
+
+        /// AVX (VEX encoding) and FMA3
+        static constexpr bool has_avx(target_arch arch) {
+            return arch >= target_arch::ARCH_X86_64_V3;
+        }
+    };
+}  // namespace mathc
@@ -0,0 +1,123 @@
+#include "token_stream.hpp"
+#include "scan_kernels.hpp"
+
+namespace mathc {
+    source_location token_stream::locate(u32 offset) const {
+        const auto it    = std::ranges::upper_bound(line_starts_, offset);
+        const auto line  = CAST<u32>(it - line_starts_.begin());
+        const u32 column = offset - *(it - 1) + 1;
+        return {line, column};
+    }
+
+    string token_stream::describe(size_t index) const {
+        const auto [line, column] = location(index);
+        return "line " + std::to_string(line) + ", column " + std::to_string(column);
+    }
+
+    token token_stream::get(size_t index) const {
+        token out(type(index));
+        switch (out.type) {
+            case token_type::TOKEN_NUMBER:
+                out.value = number(index);
+                break;
+            case token_type::TOKEN_IDENTIFIER:
+                out.value = symbol_table::global().name(symbol(index));
+                break;
+            case token_type::TOKEN_KEYWORD:
+                out.value = symbol_table::keyword_name(keyword_at(index));
+                break;
+            default:
+                break;
+        }
+
+        const auto [line, column] = location(index);
+        out.line                  = line;
+        out.column                = column;
+        return out;
+    }
+
+    void token_stream::push(token_type type, u32 offset) {
+        types_.push_back(CAST<u8>(type));
+        offsets_.push_back(offset);
+        payloads_.push_back(0);
+    }
+
+    void token_stream::push_number(u32 offset, f64 value) {
+        types_.push_back(CAST<u8>(token_type::TOKEN_NUMBER));
+        offsets_.push_back(offset);
+        payloads_.push_back(CAST<u32>(numbers_.size()));
+        numbers_.push_back(value);
+    }
+
+    void token_stream::push_identifier(u32 offset, symbol_id symbol) {
+        types_.push_back(CAST<u8>(token_type::TOKEN_IDENTIFIER));
+        offsets_.push_back(offset);
+        payloads_.push_back(symbol);
+    }
+
+    void token_stream::push_keyword(u32 offset, keyword kw) {
+        types_.push_back(CAST<u8>(token_type::TOKEN_KEYWORD));
+        offsets_.push_back(offset);
+        payloads_.push_back(CAST<u32>(kw));
+    }
+
+    void token_stream::index_lines() {
+        line_starts_.clear();
+        line_starts_.push_back(0);
+        for (size_t pos = scan_kernels::find_newline(source_, 0); pos < source_.size();
+             pos        = scan_kernels::find_newline(source_, pos + 1)) {
+            line_starts_.push_back(CAST<u32>(pos + 1));
+        }
+    }
+
+    size_t token_stream::upper_bound(u32 offset) const {
+        return CAST<size_t>(std::ranges::upper_bound(offsets_, offset) - offsets_.begin());
+    }
+
+    size_t token_stream::lower_bound(u32 offset) const {
+        return CAST<size_t>(std::ranges::lower_bound(offsets_, offset) - offsets_.begin());
+    }
+
+    void token_stream::splice(size_t first, size_t last, const token_stream& fresh, i64 delta) {
+        const size_t count = fresh.size();
+        const auto pos     = CAST<std::ptrdiff_t>(first);
+        const auto end     = CAST<std::ptrdiff_t>(last);
+
+        for (size_t i = last; i < offsets_.size(); ++i) {
+            offsets_[i] = CAST<u32>(offsets_[i] + delta);
+        }
+
+        // Fresh numbers are appended to the side table; the replaced ones become garbage until the next compaction
+        vector<u32> payloads(fresh.payloads_);
+        for (size_t i = 0; i < count; ++i) {
+            if (fresh.type(i) == token_type::TOKEN_NUMBER) {
+                payloads[i] = CAST<u32>(numbers_.size());
+                numbers_.push_back(fresh.numbers_[fresh.payloads_[i]]);
+            }
+        }
+
+        types_.erase(types_.begin() + pos, types_.begin() + end);
+        types_.insert(types_.begin() + pos, fresh.types_.begin(), fresh.types_.end());
+        offsets_.erase(offsets_.begin() + pos, offsets_.begin() + end);
+        offsets_.insert(offsets_.begin() + pos, fresh.offsets_.begin(), fresh.offsets_.end());
+        payloads_.erase(payloads_.begin() + pos, payloads_.begin() + end);
+        payloads_.insert(payloads_.begin() + pos, payloads.begin(), payloads.end());
+
+        if (numbers_.size() > 2 * types_.size()) {
+            vector<f64> live;
+            for (size_t i = 0; i < types_.size(); ++i) {
+                if (type(i) == token_type::TOKEN_NUMBER) {
+                    const f64 value = numbers_[payloads_[i]];
+                    payloads_[i]    = CAST<u32>(live.size());
+                    live.push_back(value);
+                }
+            }
+            numbers_ = std::move(live);
+        }
+    }
+
+    void token_stream::rebind(std::string_view source) {
+        source_ = source;
+        index_lines();
+    }
+}  // namespace mathc
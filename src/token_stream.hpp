@@ -0,0 +1,96 @@
+#pragma once
+
+#include "token.hpp"
+#include "symbol_table.hpp"
+#include <algorithm>
+#include <string_view>
+
+namespace mathc {
+    /// @brief 1-based line and column of a byte in the source
+    struct source_location {
+        u32 line;
+        u32 column;
+    };
+
+    /// @brief A whole lexed file stored as a struct of arrays.
+    ///
+    /// Token `i` is `types_[i]` starting at byte `offsets_[i]`. `payloads_[i]` holds the interned `symbol_id` of an
+    /// identifier, the `keyword` of a keyword, or an index into the side table of numeric values. The stream always
+    /// ends with `TOKEN_EOF` and reads past the end return it, so the parser can look ahead any distance without
+    /// bounds checks.
+    class token_stream {
+    public:
+        token_stream() = default;
+
+        explicit token_stream(std::string_view source) : source_(source) {}
+
+        [[nodiscard]] size_t size() const {
+            return types_.size();
+        }
+
+        [[nodiscard]] token_type type(size_t index) const {
+            return CAST<token_type>(types_[clamp(index)]);
+        }
+
+        [[nodiscard]] u32 offset(size_t index) const {
+            return offsets_[clamp(index)];
+        }
+
+        [[nodiscard]] f64 number(size_t index) const {
+            return numbers_[payloads_[clamp(index)]];
+        }
+
+        [[nodiscard]] symbol_id symbol(size_t index) const {
+            return payloads_[clamp(index)];
+        }
+
+        [[nodiscard]] keyword keyword_at(size_t index) const {
+            return CAST<keyword>(payloads_[clamp(index)]);
+        }
+
+        [[nodiscard]] source_location location(size_t index) const {
+            return locate(offset(index));
+        }
+
+        [[nodiscard]] source_location locate(u32 offset) const;
+
+        /// Formats the position of a token as "line L, column C" for diagnostics
+        [[nodiscard]] string describe(size_t index) const;
+
+        /// Materializes token `index`, e.g. for printing
+        [[nodiscard]] token get(size_t index) const;
+
+        void push(token_type type, u32 offset);
+        void push_number(u32 offset, f64 value);
+        void push_identifier(u32 offset, symbol_id symbol);
+        void push_keyword(u32 offset, keyword kw);
+
+        /// Records the start of every line so `locate` is a binary search
+        void index_lines();
+
+        /// Index of the first token that starts after byte `offset`
+        [[nodiscard]] size_t upper_bound(u32 offset) const;
+
+        /// Index of the first token that starts at or after byte `offset`
+        [[nodiscard]] size_t lower_bound(u32 offset) const;
+
+        /// Replaces tokens [first, last) with every token of `fresh` and moves the tokens after them by `delta` bytes.
+        /// `fresh` must not contain an EOF token.
+        void splice(size_t first, size_t last, const token_stream& fresh, i64 delta);
+
+        /// Points the stream at a new copy of its source (e.g. after an edit) and re-indexes its lines
+        void rebind(std::string_view source);
+
+    private:
+        std::string_view source_;
+        vector<u8> types_;
+        vector<u32> offsets_;
+        vector<u32> payloads_;
+        vector<f64> numbers_;
+        vector<u32> line_starts_;
+
+        [[nodiscard]] size_t clamp(size_t index) const {
+            return std::min(index, types_.size() - 1);
+        }
+    };
+}  // namespace mathc
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "asm_instruction.hpp"
+#include "symbol_table.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+
+namespace mathc {
+    /// @brief Where each variable lives in the program's variable block.
+    ///
+    /// All variables share one 64-byte-aligned block in .bss, addressed from `rbx`. Slots are handed out in order of
+    /// how often the code refers to each variable, so the hottest variables share the first cache lines and get the
+    /// short `[rbx + disp8]` encoding; ties keep declaration order. Variables the code accesses as a pair (packed loads
+    /// and stores) are kept next to each other where that does not conflict with another pair, and are placed where
+    /// the hottest variable of their chain would go.
+    class variable_layout {
+    public:
+        static constexpr u32 slot_size       = 8;
+        static constexpr u32 cache_line_size = 64;
+
+        variable_layout() = default;
+
+        /// Lays out `variables` (in declaration order) by counting their operands in `code`; `adjacent` lists pairs of
+        /// variables that should be consecutive, low one first
+        variable_layout(const asm_code& code,
+                        span<const symbol_id> variables,
+                        span<const std::pair<symbol_id, symbol_id>> adjacent) {
+            symbol_id max_symbol = 0;
+            for (const symbol_id symbol : variables) {
+                max_symbol = std::max(max_symbol, symbol);
+            }
+            accesses_.assign(variables.empty() ? 0 : max_symbol + 1, 0);
+            offsets_.assign(accesses_.size(), 0);
+
+            for (const asm_instruction& instruction : code.instructions) {
+                for (u8 i = 0; i < instruction.operand_count; ++i) {
+                    if (instruction.operands[i].kind == operand_kind::OPERAND_VAR) {
+                        ++accesses_[instruction.operands[i].index];
+                    }
+                }
+            }
+
+            // Link pairs into chains; a pair is dropped if either side is already taken or it would close a cycle
+            vector<symbol_id> next(accesses_.size(), no_symbol);
+            vector<symbol_id> prev(accesses_.size(), no_symbol);
+            for (const auto& [low, high] : adjacent) {
+                if (next[low] != no_symbol || prev[high] != no_symbol) {
+                    continue;
+                }
+                symbol_id head = low;
+                while (prev[head] != no_symbol) {
+                    head = prev[head];
+                }
+                if (head != high) {
+                    next[low]  = high;
+                    prev[high] = low;
+                }
+            }
+
+            vector<symbol_id> by_accesses(variables.begin(), variables.end());
+            std::stable_sort(by_accesses.begin(), by_accesses.end(),
+                             [this](symbol_id a, symbol_id b) { return accesses_[a] > accesses_[b]; });
+
+            vector<bool> placed(accesses_.size());
+            order_.reserve(by_accesses.size());
+            for (symbol_id symbol : by_accesses) {
+                if (placed[symbol]) {
+                    continue;
+                }
+                while (prev[symbol] != no_symbol) {
+                    symbol = prev[symbol];
+                }
+                for (; symbol != no_symbol; symbol = next[symbol]) {
+                    offsets_[symbol] = CAST<u32>(order_.size()) * slot_size;
+                    placed[symbol]   = true;
+                    order_.push_back(symbol);
+                }
+            }
+        }
+
+        /// Byte offset of a variable from the start of the block
+        [[nodiscard]] u32 offset(symbol_id symbol) const {
+            return offsets_[symbol];
+        }
+
+        /// Symbol id -> byte offset, for `asm_renderer`
+        [[nodiscard]] span<const u32> offsets() const {
+            return offsets_;
+        }
+
+        /// Size of the block, rounded up to whole cache lines
+        [[nodiscard]] u32 size() const {
+            const auto bytes = CAST<u32>(order_.size()) * slot_size;
+            return (bytes + cache_line_size - 1) / cache_line_size * cache_line_size;
+        }
+
+        [[nodiscard]] bool empty() const {
+            return order_.empty();
+        }
+
+        /// Writes one line per slot: offset, cache line, access count and name
+        void dump(std::ostream& out) const {
+            out << "offset  line  accesses  variable\n";
+            for (const symbol_id symbol : order_) {
+                const u32 off = offset(symbol);
+                out << std::setw(6) << off << "  " << std::setw(4) << off / cache_line_size << "  " << std::setw(8)
+                    << accesses_[symbol] << "  " << symbol_table::global().name(symbol) << "\n";
+            }
+            out << order_.size() << " variables in " << size() / cache_line_size << " cache lines\n";
+        }
+
+    private:
+        static constexpr symbol_id no_symbol = ~symbol_id {0};
+
+        vector<u32> accesses_;     // symbol id -> operands referring to it
+        vector<u32> offsets_;      // symbol id -> byte offset in the block
+        vector<symbol_id> order_;  // slot -> symbol id
+    };
+}  // namespace mathc
@@ -0,0 +1,310 @@
+#include "watch.hpp"
+#include "parser.hpp"
+#include "scanner.hpp"
+
+#include <sys/inotify.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <unordered_set>
+
+namespace mathc {
+    watch_session::watch_session(path filename, const compile_options& options, build_function build)
+        : filename_(std::move(filename)), options_(options), build_(std::move(build)), codegen_(options) {}
+
+    i32 watch_session::run() {
+        rebuild();
+
+        const i32 fd = inotify_init1(IN_CLOEXEC);
+        if (fd < 0) {
+            std::cerr << "error: failed to initialize inotify\n";
+            return 1;
+        }
+
+        // Editors often save by writing a new file and renaming it over the old one, which would drop a watch on the
+        // file itself, so watch its directory and filter by name
+        const path directory = filename_.has_parent_path() ? filename_.parent_path() : path(".");
+        const string name    = filename_.filename().string();
+        if (inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+            std::cerr << "error: failed to watch directory: " << absolute(directory) << "\n";
+            close(fd);
+            return 1;
+        }
+
+        std::cout << "\nWatching " << filename_.string() << " for changes (Ctrl+C to stop)" << std::endl;
+
+        alignas(inotify_event) char buffer[4096];
+        while (true) {
+            const ssize_t length = read(fd, buffer, sizeof(buffer));
+            if (length < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                std::cerr << "error: failed to read file system events\n";
+                close(fd);
+                return 1;
+            }
+
+            // One save usually produces several events; rebuild once per batch
+            bool changed = false;
+            for (ssize_t i = 0; i < length;) {
+                const auto* event = RCAST<const inotify_event*>(buffer + i);
+                if (event->len > 0 && name == event->name) {
+                    changed = true;
+                }
+                i += CAST<ssize_t>(sizeof(inotify_event) + event->len);
+            }
+
+            if (changed) {
+                rebuild();
+            }
+        }
+    }
+
+    i32 watch_session::rebuild() {
+        const auto start = std::chrono::high_resolution_clock::now();
+
+        // Read into memory rather than mapping the file, which an editor may truncate while we are looking at it
+        string text;
+        if (!read_source(text)) {
+            std::cerr << "error: failed to read file: " << filename_.string() << "\n";
+            return 1;
+        }
+
+        if (initialized_ && text == text_) {
+            return 0;
+        }
+
+        std::cout << "\n[1/1] " << filename_.string() << "\n";
+
+        rebuild_stats stats;
+        try {
+            if (initialized_) {
+                incremental_update(std::move(text), stats);
+            } else {
+                full_update(std::move(text), stats);
+            }
+            initialized_ = true;
+        } catch (const std::exception& e) {
+            // Whatever state the failed update left behind is discarded; the next save is compiled from scratch
+            initialized_ = false;
+            std::cerr << "error: " << e.what() << "\n";
+            return 1;
+        }
+
+        program_output program;
+        try {
+            program = link(stats);
+        } catch (const codegen_error& e) {
+            std::cerr << "error: " << e.what() << "\n";
+            return 1;
+        }
+
+        const i32 result = build_(program);
+
+        const auto end     = std::chrono::high_resolution_clock::now();
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+        std::cout << "Re-lexed " << stats.tokens_lexed << " tokens, re-parsed " << stats.statements_parsed
+                  << " statements, compiled " << stats.fragments_compiled << " fragments in "
+                  << CAST<f64>(elapsed.count()) / 1000.0 << "ms" << std::endl;
+
+        return result;
+    }
+
+    bool watch_session::read_source(string& text_out) const {
+        std::ifstream file(filename_, std::ios::binary);
+        if (!file.is_open()) {
+            return false;
+        }
+
+        text_out.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !file.bad();
+    }
+
+    void watch_session::full_update(string&& text, rebuild_stats& stats) {
+        text_ = std::move(text);
+
+        token_scanner scanner(text_);
+        tokens_  = scanner.scan_all();
+        program_ = ast_program();
+        program_.reserve(tokens_.size());
+        statements_.clear();
+
+        stats.tokens_lexed = tokens_.size();
+        parse_statements(0, statements_, [](size_t) { return false; }, stats);
+    }
+
+    void watch_session::incremental_update(string&& text, rebuild_stats& stats) {
+        // Narrow the edit down to old bytes [prefix, old_end) having become new bytes [prefix, new_end)
+        const size_t common = std::min(text_.size(), text.size());
+        const size_t prefix = CAST<size_t>(std::ranges::mismatch(text_, text).in1 - text_.begin());
+        size_t suffix       = 0;
+        while (suffix < common - prefix && text_[text_.size() - 1 - suffix] == text[text.size() - 1 - suffix]) {
+            ++suffix;
+        }
+        const size_t new_end = text.size() - suffix;
+        const i64 delta      = CAST<i64>(text.size()) - CAST<i64>(text_.size());
+
+        text_ = std::move(text);
+        tokens_.rebind(text_);
+
+        // Only the token running into the edit can change, but step back one more so the lexer restarts from a point
+        // whose meaning does not depend on the edited bytes
+        const size_t touched = tokens_.upper_bound(CAST<u32>(prefix));
+        const size_t first   = touched > 2 ? touched - 2 : 0;
+        const u64 begin      = first == 0 ? 0 : tokens_.offset(first);
+
+        // Past the edit, the lexer is back in step as soon as it starts a token where an old token started
+        const size_t old_count = tokens_.size() - 1;  // not counting EOF
+        const auto resync_lexer = [&](u64 offset) {
+            if (offset < new_end) {
+                return false;
+            }
+            const auto old_offset = CAST<u32>(CAST<i64>(offset) - delta);
+            const size_t index    = tokens_.lower_bound(old_offset);
+            return index < old_count && tokens_.offset(index) == old_offset;
+        };
+
+        u64 stop = 0;
+        token_scanner scanner(text_);
+        const token_stream fresh = scanner.scan_until(begin, resync_lexer, stop);
+        const size_t last =
+            stop >= text_.size() ? old_count : tokens_.lower_bound(CAST<u32>(CAST<i64>(stop) - delta));
+
+        tokens_.splice(first, last, fresh, delta);
+        stats.tokens_lexed = fresh.size();
+
+        const i64 token_delta = CAST<i64>(fresh.size()) - CAST<i64>(last - first);
+
+        // A statement's parse depends on its tokens and the one after it (which decides whether a ';' follows), so
+        // statements ending before `first` are untouched
+        const auto kept = std::ranges::partition_point(statements_, [&](const statement& s) { return s.end < first; });
+        const size_t keep_count = CAST<size_t>(kept - statements_.begin());
+        const size_t restart    = keep_count == 0 ? 0 : statements_[keep_count - 1].end;
+
+        // Past the new tokens, the parser is back in step as soon as a statement would start where an old one did
+        const size_t fresh_end = first + fresh.size();
+        size_t reuse_from      = statements_.size();
+        const auto resync_parser = [&](size_t pos) {
+            if (pos < fresh_end) {
+                return false;
+            }
+            const auto old_pos = CAST<size_t>(CAST<i64>(pos) - token_delta);
+            const auto it = std::ranges::lower_bound(statements_.begin() + CAST<std::ptrdiff_t>(keep_count),
+                                                     statements_.end(), old_pos, {}, &statement::begin);
+            if (it == statements_.end() || it->begin != old_pos) {
+                return false;
+            }
+            reuse_from = CAST<size_t>(it - statements_.begin());
+            return true;
+        };
+
+        vector<statement> reparsed;
+        parse_statements(restart, reparsed, resync_parser, stats);
+
+        vector<statement> statements(statements_.begin(), kept);
+        statements.insert(statements.end(), reparsed.begin(), reparsed.end());
+        for (size_t i = reuse_from; i < statements_.size(); ++i) {
+            statement moved = statements_[i];
+            moved.begin     = CAST<size_t>(CAST<i64>(moved.begin) + token_delta);
+            moved.end       = CAST<size_t>(CAST<i64>(moved.end) + token_delta);
+            statements.push_back(moved);
+        }
+        statements_ = std::move(statements);
+
+        // Replaced statements leave their nodes behind; start over before the garbage outgrows the live program
+        if (program_.node_count() > 2 * tokens_.size() + 1024) {
+            full_update(string(text_), stats);
+        }
+    }
+
+    void watch_session::parse_statements(size_t pos,
+                                         vector<statement>& out,
+                                         const std::function<bool(size_t)>& resync,
+                                         rebuild_stats& stats) {
+        expr_parser parser(tokens_, std::move(program_));
+
+        try {
+            while (!resync(pos)) {
+                statement parsed {pos, 0, 0};
+                if (!parser.parse_statement(pos, parsed.root)) {
+                    break;
+                }
+
+                parsed.end = pos;
+                out.push_back(parsed);
+                ++stats.statements_parsed;
+            }
+        } catch (...) {
+            program_ = parser.take_program();
+            throw;
+        }
+
+        program_ = parser.take_program();
+    }
+
+    program_output watch_session::link(rebuild_stats& stats) {
+        asm_emitter linked(options_.arch);
+        std::unordered_set<const vector<u64>*> used;  // Keys of the fragments linked in
+        ast_optimizer optimizer(program_);
+        mathc_program optimized;
+
+        for (const statement& s : statements_) {
+            const mathc_program* compiled = &program_;
+            ast_ref root                  = s.root;
+            if (options_.level != opt_level::O0) {
+                optimized.clear();
+                compiled = &optimized;
+                root     = optimizer.optimize_statement(s.root, optimized);
+            }
+
+            vector<u64> key = compiled->canonical(root);
+            auto cached     = fragments_.find(key);
+            if (cached == fragments_.end()) {
+                cached = fragments_.emplace(std::move(key), codegen_.generate_statement(*compiled, root)).first;
+                ++stats.fragments_compiled;
+            }
+            const statement_code& fragment = cached->second;
+
+            for (const symbol_id symbol : fragment.loads) {
+                if (!linked.has_var(symbol)) {
+                    throw codegen_error("Undefined variable: " + string(symbol_table::global().name(symbol)));
+                }
+            }
+            for (const symbol_id symbol : fragment.stores) {
+                linked.declare_var(symbol);
+            }
+
+            for (const f64 literal : fragment.literals) {
+                linked.declare_literal(literal);
+            }
+
+            linked.append_code(fragment.code);
+            linked.reserve_stack_slots(fragment.stack_slots);
+            if (fragment.prints) {
+                linked.set_uses_print();
+            }
+
+            used.insert(&cached->first);
+        }
+
+        // The peephole optimizer sees across fragment boundaries (e.g. a store at the end of one statement and a load
+        // at the start of the next), so it runs on the linked program
+        if (options_.peephole) {
+            linked.run_peephole();
+        }
+        if (options_.fp_contract) {
+            linked.contract_multiply_adds();
+        }
+
+        // Forget fragments of statements that no longer exist
+        std::erase_if(fragments_, [&used](const auto& entry) { return !used.contains(&entry.first); });
+        return linked.take_output(options_.emit, options_.freestanding, options_.format);
+    }
+}  // namespace mathc
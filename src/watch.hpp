@@ -0,0 +1,66 @@
+#pragma once
+
+#include "mathc_common.hpp"
+#include "ast.hpp"
+#include "codegen.hpp"
+#include "optimizer.hpp"
+#include "options.hpp"
+#include "token_stream.hpp"
+#include <functional>
+
+namespace mathc {
+    /// @brief Recompiles a source file every time it is saved, redoing only the work its edit invalidated.
+    ///
+    /// The last version of the file is kept as tokens, one AST per statement and one code fragment per distinct
+    /// statement. An edit is narrowed to the bytes that changed; tokens are re-lexed from just before that range until
+    /// the lexer is back in step with the old stream, and statements are re-parsed from the last one the edit cannot
+    /// have touched until the parser lands on an old statement boundary again. Statements are then optimized afresh,
+    /// since a constant assigned by one statement changes the code of every later one that reads it, and code is only
+    /// generated for optimized statements whose tree has not been seen before. Linking the fragments into a program is
+    /// cheap and always redone. The whole-program IR passes are skipped: they would tie every fragment to the rest of
+    /// the program.
+    class watch_session {
+    public:
+        /// Turns a compiled program into an executable, returning non-zero on failure
+        using build_function = std::function<i32(const program_output& program)>;
+
+        watch_session(path filename, const compile_options& options, build_function build);
+
+        /// Builds the file once, then rebuilds it after every save. Only returns if the file cannot be watched.
+        i32 run();
+
+    private:
+        struct statement {
+            size_t begin;  // token where parsing started (before any leading ';')
+            size_t end;    // token after the statement
+            ast_ref root;
+        };
+
+        struct rebuild_stats {
+            size_t tokens_lexed       = 0;
+            size_t statements_parsed  = 0;
+            size_t fragments_compiled = 0;
+        };
+
+        path filename_;
+        compile_options options_;
+        build_function build_;
+        bool initialized_ = false;
+
+        string text_;
+        token_stream tokens_;
+        ast_program program_;
+        vector<statement> statements_;
+        code_generator codegen_;
+        // Keyed by the statement's tree as compiled, in canonical form, so only an equal tree reuses a fragment
+        unordered_map<vector<u64>, statement_code, canonical_hash> fragments_;
+
+        i32 rebuild();
+        bool read_source(string& text_out) const;
+        void full_update(string&& text, rebuild_stats& stats);
+        void incremental_update(string&& text, rebuild_stats& stats);
+        void parse_statements(size_t pos, vector<statement>& out, const std::function<bool(size_t)>& resync,
+                              rebuild_stats& stats);
+        program_output link(rebuild_stats& stats);
+    };
+}  // namespace mathc
@@ -0,0 +1,375 @@
+#include "x86_encoder.hpp"
+
+namespace mathc {
+    namespace {
+        constexpr u8 MAP_0F   = 1;
+        constexpr u8 MAP_0F38 = 2;
+        constexpr u8 MAP_0F3A = 3;
+
+        /// @brief How an SSE instruction is encoded
+        struct sse_form {
+            u8 prefix;      // mandatory prefix: 0x66, 0xF2 or none
+            u8 map;         // opcode map after 0F
+            u8 load;        // opcode with the destination in ModRM.reg
+            u8 store;       // opcode with the destination in ModRM.rm, or 0
+            bool wide;      // REX.W / VEX.W
+            i16 predicate;  // implied immediate, or -1
+        };
+
+        // In `asm_opcode` order, OP_MOVSD to OP_VBROADCASTSD
+        constexpr sse_form sse_forms[] = {
+            {0xF2, MAP_0F, 0x10, 0x11, false, -1},    // movsd
+            {0x66, MAP_0F, 0x28, 0x29, false, -1},    // movapd
+            {0x66, MAP_0F, 0x57, 0, false, -1},       // xorpd
+            {0xF2, MAP_0F, 0x58, 0, false, -1},       // addsd
+            {0xF2, MAP_0F, 0x5C, 0, false, -1},       // subsd
+            {0xF2, MAP_0F, 0x59, 0, false, -1},       // mulsd
+            {0xF2, MAP_0F, 0x5E, 0, false, -1},       // divsd
+            {0x66, MAP_0F3A, 0x0B, 0, false, -1},     // roundsd
+            {0x66, MAP_0F, 0x16, 0x17, false, -1},    // movhpd
+            {0x66, MAP_0F, 0x10, 0x11, false, -1},    // movupd
+            {0x66, MAP_0F, 0x14, 0, false, -1},       // unpcklpd
+            {0x66, MAP_0F, 0x58, 0, false, -1},       // addpd
+            {0x66, MAP_0F, 0x5C, 0, false, -1},       // subpd
+            {0x66, MAP_0F, 0x59, 0, false, -1},       // mulpd
+            {0x66, MAP_0F, 0x5E, 0, false, -1},       // divpd
+            {0x66, MAP_0F3A, 0x09, 0, false, -1},     // roundpd
+            {0x66, MAP_0F, 0x54, 0, false, -1},       // andpd
+            {0x66, MAP_0F, 0x55, 0, false, -1},       // andnpd
+            {0x66, MAP_0F, 0x56, 0, false, -1},       // orpd
+            {0xF2, MAP_0F, 0xC2, 0, false, 1},        // cmpltsd: cmpsd with predicate 1
+            {0xF2, MAP_0F, 0x2C, 0, true, -1},        // cvttsd2si r64
+            {0xF2, MAP_0F, 0x2A, 0, true, -1},        // cvtsi2sd from r64
+            {0x66, MAP_0F, 0x6E, 0x7E, true, -1},     // movq
+            {0x66, MAP_0F38, 0x99, 0, true, -1},      // vfmadd132sd
+            {0x66, MAP_0F38, 0xA9, 0, true, -1},      // vfmadd213sd
+            {0x66, MAP_0F38, 0xB9, 0, true, -1},      // vfmadd231sd
+            {0x66, MAP_0F38, 0x9B, 0, true, -1},      // vfmsub132sd
+            {0x66, MAP_0F38, 0xAB, 0, true, -1},      // vfmsub213sd
+            {0x66, MAP_0F38, 0xBD, 0, true, -1},      // vfnmadd231sd
+            {0x66, MAP_0F3A, 0x18, 0, false, -1},     // vinsertf128
+            {0x66, MAP_0F3A, 0, 0x19, false, -1},     // vextractf128
+            {0x66, MAP_0F38, 0x19, 0, false, -1},     // vbroadcastsd
+        };
+
+        bool is_sse(asm_opcode opcode) {
+            return opcode <= asm_opcode::OP_VBROADCASTSD;
+        }
+
+        bool is_vector(const asm_operand& operand) {
+            return operand.kind == operand_kind::OPERAND_XMM || operand.kind == operand_kind::OPERAND_YMM;
+        }
+
+        bool is_register(const asm_operand& operand) {
+            return is_vector(operand) || operand.kind == operand_kind::OPERAND_GPR;
+        }
+
+        /// Register number in ModRM/REX/VEX fields
+        u8 register_number(const asm_operand& operand) {
+            if (is_vector(operand)) {
+                return CAST<u8>(operand.index);
+            }
+            static constexpr u8 gpr_numbers[] = {0, 0, 5, 4, 7, 3, 7, 6, 2};  // In `gpr` order
+            return gpr_numbers[operand.index];
+        }
+
+        /// A 64-bit general-purpose register
+        bool is_wide(const asm_operand& operand) {
+            switch (CAST<gpr>(operand.index)) {
+                case gpr::GPR_EAX:
+                case gpr::GPR_EDI:
+                case gpr::GPR_EDX:
+                    return false;
+                default:
+                    return true;
+            }
+        }
+
+        bool fits_i8(i64 value) {
+            return value >= -128 && value <= 127;
+        }
+
+        [[noreturn]] void unsupported(const asm_instruction& instruction) {
+            throw encode_error("cannot encode instruction with opcode " +
+                               std::to_string(CAST<u32>(instruction.opcode)));
+        }
+    }  // namespace
+
+    machine_code x86_encoder::encode(const asm_code& code, span<const u32> var_offsets, bool vex) {
+        x86_encoder encoder(var_offsets, vex);
+        encoder.out_.bytes.reserve(code.instructions.size() * 5);
+        for (const asm_instruction& instruction : code.instructions) {
+            encoder.encode_instruction(instruction);
+        }
+        return std::move(encoder.out_);
+    }
+
+    void x86_encoder::encode_instruction(const asm_instruction& instruction) {
+        switch (instruction.opcode) {
+            case asm_opcode::OP_COMMENT:
+                return;
+            case asm_opcode::OP_LABEL:
+                out_.labels.emplace_back(CAST<asm_label>(instruction.dst().index), CAST<u32>(out_.bytes.size()));
+                return;
+            default:
+                break;
+        }
+
+        if (is_sse(instruction.opcode)) {
+            encode_sse(instruction);
+        } else {
+            encode_general(instruction);
+        }
+    }
+
+    void x86_encoder::encode_sse(const asm_instruction& instruction) {
+        const sse_form& form = sse_forms[CAST<size_t>(instruction.opcode)];
+        const bool vex       = vex_ && written_operands::has_vex_form(instruction.opcode);
+        const bool vex_only  = instruction.opcode >= asm_opcode::OP_VFMADD132SD;  // FMA and AVX
+        const written_operands written = written_operands::of(instruction, vex_);
+
+        // Any ymm operand makes it a 256-bit instruction
+        bool ymm = false;
+        for (u8 i = 0; i < written.count; ++i) {
+            ymm = ymm || written.operands[i].kind == operand_kind::OPERAND_YMM;
+        }
+
+        // A trailing immediate, written or implied by the mnemonic
+        u8 count      = written.count;
+        i64 immediate = form.predicate;
+        if (count > 0 && written.operands[count - 1].kind == operand_kind::OPERAND_IMM) {
+            immediate = CAST<i64>(written.operands[--count].value);
+        }
+        const u8 immediate_size = immediate >= 0 ? 1 : 0;
+
+        const asm_operand& dst = written.operands[0];
+        u8 opcode              = form.load;
+        u8 reg                 = 0;
+        u8 vvvv                = 0;
+        asm_operand rm;
+        if (count == 2) {
+            // movq to a general-purpose register and vextractf128 to an xmm one are store forms too: the source
+            // register goes in ModRM.reg
+            const bool store = dst.is_memory() ||
+                               (instruction.opcode == asm_opcode::OP_MOVQ && dst.kind == operand_kind::OPERAND_GPR) ||
+                               instruction.opcode == asm_opcode::OP_VEXTRACTF128;
+            if (store) {
+                if (form.store == 0) {
+                    unsupported(instruction);
+                }
+                opcode = form.store;
+                reg    = register_number(written.operands[1]);
+                rm     = dst;
+            } else {
+                reg = register_number(dst);
+                rm  = written.operands[1];
+            }
+        } else if (count == 3 && (vex || vex_only)) {
+            reg  = register_number(dst);
+            vvvv = register_number(written.operands[1]);
+            rm   = written.operands[2];
+        } else {
+            unsupported(instruction);
+        }
+        if ((!is_register(rm) && !rm.is_memory()) || (ymm && !vex && !vex_only)) {
+            unsupported(instruction);
+        }
+
+        if (vex || vex_only) {
+            emit_vex(form.prefix, form.map, opcode, form.wide, ymm, reg, vvvv, rm, immediate_size);
+        } else {
+            array<u8, 3> bytes {0x0F};
+            u8 size = 1;
+            if (form.map == MAP_0F38) {
+                bytes[size++] = 0x38;
+            } else if (form.map == MAP_0F3A) {
+                bytes[size++] = 0x3A;
+            }
+            bytes[size++] = opcode;
+            emit_legacy(form.prefix, span<const u8>(bytes.data(), size), form.wide, reg, rm, immediate_size);
+        }
+        if (immediate_size != 0) {
+            put(CAST<u8>(immediate));
+        }
+    }
+
+    void x86_encoder::encode_general(const asm_instruction& instruction) {
+        const asm_operand& dst = instruction.dst();
+        const asm_operand& src = instruction.src();
+        const auto one         = [](u8 opcode) { return array<u8, 1> {opcode}; };
+
+        switch (instruction.opcode) {
+            case asm_opcode::OP_PUSH:
+            case asm_opcode::OP_POP:
+                if (dst.kind != operand_kind::OPERAND_GPR) {
+                    unsupported(instruction);
+                }
+                put(CAST<u8>((instruction.opcode == asm_opcode::OP_PUSH ? 0x50 : 0x58) + register_number(dst)));
+                return;
+            case asm_opcode::OP_CALL:
+                if (dst.kind != operand_kind::OPERAND_LABEL) {
+                    unsupported(instruction);
+                }
+                put(0xE8);
+                out_.references.push_back({CAST<u32>(out_.bytes.size()), dst, -4});
+                emit_u32(0);
+                return;
+            case asm_opcode::OP_RET:
+                put(0xC3);
+                return;
+            case asm_opcode::OP_SYSCALL:
+                put(0x0F);
+                put(0x05);
+                return;
+            case asm_opcode::OP_VZEROUPPER:
+                put(0xC5);
+                put(0xF8);
+                put(0x77);
+                return;
+            case asm_opcode::OP_NOP:
+                put(0x90);
+                return;
+            case asm_opcode::OP_LEA:
+                if (dst.kind != operand_kind::OPERAND_GPR || !src.is_memory()) {
+                    unsupported(instruction);
+                }
+                emit_legacy(0, one(0x8D), is_wide(dst), register_number(dst), src, 0);
+                return;
+            default:
+                break;
+        }
+
+        // mov and the arithmetic group, with a register destination (or memory for stores)
+        struct alu_form {
+            u8 store;      // r/m <- reg
+            u8 load;       // reg <- r/m
+            u8 extension;  // ModRM.reg of the immediate forms
+        };
+        alu_form form {};
+        switch (instruction.opcode) {
+            case asm_opcode::OP_MOV:
+                form = {0x89, 0x8B, 0};
+                break;
+            case asm_opcode::OP_ADD:
+                form = {0x01, 0x03, 0};
+                break;
+            case asm_opcode::OP_SUB:
+                form = {0x29, 0x2B, 5};
+                break;
+            case asm_opcode::OP_AND:
+                form = {0x21, 0x23, 4};
+                break;
+            case asm_opcode::OP_XOR:
+                form = {0x31, 0x33, 6};
+                break;
+            default:
+                unsupported(instruction);
+        }
+
+        if (dst.kind == operand_kind::OPERAND_GPR && src.kind == operand_kind::OPERAND_GPR) {
+            emit_legacy(0, one(form.store), is_wide(dst), register_number(src), dst, 0);
+        } else if (dst.kind == operand_kind::OPERAND_GPR && src.is_memory()) {
+            emit_legacy(0, one(form.load), is_wide(dst), register_number(dst), src, 0);
+        } else if (dst.is_memory() && src.kind == operand_kind::OPERAND_GPR) {
+            emit_legacy(0, one(form.store), is_wide(src), register_number(src), dst, 0);
+        } else if (dst.kind == operand_kind::OPERAND_GPR && src.kind == operand_kind::OPERAND_IMM) {
+            const auto value = CAST<i64>(src.value);
+            if (instruction.opcode == asm_opcode::OP_MOV) {
+                if (is_wide(dst)) {
+                    emit_legacy(0, one(0xC7), true, 0, dst, 4);  // Sign-extended imm32
+                } else {
+                    put(CAST<u8>(0xB8 + register_number(dst)));
+                }
+                emit_u32(CAST<u32>(value));
+            } else if (fits_i8(value)) {
+                emit_legacy(0, one(0x83), is_wide(dst), form.extension, dst, 1);
+                put(CAST<u8>(value));
+            } else {
+                emit_legacy(0, one(0x81), is_wide(dst), form.extension, dst, 4);
+                emit_u32(CAST<u32>(value));
+            }
+        } else {
+            unsupported(instruction);
+        }
+    }
+
+    void x86_encoder::emit_legacy(u8 prefix, span<const u8> opcode, bool wide, u8 reg, const asm_operand& rm,
+                                  u8 immediate_size) {
+        if (prefix != 0) {
+            put(prefix);
+        }
+        const u8 b   = is_register(rm) && register_number(rm) >= 8 ? 1 : 0;
+        const u8 rex = CAST<u8>((wide ? 8 : 0) | (reg >= 8 ? 4 : 0) | b);
+        if (rex != 0) {
+            put(CAST<u8>(0x40 | rex));
+        }
+        for (const u8 byte : opcode) {
+            put(byte);
+        }
+        emit_modrm(reg, rm, immediate_size);
+    }
+
+    void x86_encoder::emit_vex(u8 prefix, u8 map, u8 opcode, bool wide, bool ymm, u8 reg, u8 vvvv,
+                               const asm_operand& rm, u8 immediate_size) {
+        const u8 pp      = CAST<u8>((ymm ? 4 : 0) | (prefix == 0x66 ? 1 : prefix == 0xF3 ? 2 : prefix == 0xF2 ? 3 : 0));
+        const bool r     = reg >= 8;
+        const bool b     = is_register(rm) && register_number(rm) >= 8;
+        const u8 v_field = CAST<u8>((~vvvv & 0xF) << 3);
+        if (map == MAP_0F && !wide && !b) {
+            put(0xC5);
+            put(CAST<u8>((r ? 0 : 0x80) | v_field | pp));
+        } else {
+            put(0xC4);
+            put(CAST<u8>((r ? 0 : 0x80) | 0x40 | (b ? 0 : 0x20) | map));  // X is never used
+            put(CAST<u8>((wide ? 0x80 : 0) | v_field | pp));
+        }
+        put(opcode);
+        emit_modrm(reg, rm, immediate_size);
+    }
+
+    void x86_encoder::emit_modrm(u8 reg, const asm_operand& rm, u8 immediate_size) {
+        const auto reg_field = CAST<u8>((reg & 7) << 3);
+        u8 base              = 0;
+        u32 displacement     = 0;
+        switch (rm.kind) {
+            case operand_kind::OPERAND_XMM:
+            case operand_kind::OPERAND_YMM:
+            case operand_kind::OPERAND_GPR:
+                put(CAST<u8>(0xC0 | reg_field | (register_number(rm) & 7)));
+                return;
+            case operand_kind::OPERAND_LITERAL:
+            case operand_kind::OPERAND_DATA:
+                put(CAST<u8>(0x05 | reg_field));  // [rip + disp32]
+                out_.references.push_back({CAST<u32>(out_.bytes.size()), rm, -4 - immediate_size});
+                emit_u32(0);
+                return;
+            case operand_kind::OPERAND_VAR:
+                base         = 3;  // rbx
+                displacement = var_offsets_[rm.index];
+                break;
+            case operand_kind::OPERAND_STACK:
+                base         = 4;  // rsp, which needs a SIB byte
+                displacement = rm.index;
+                break;
+            default:
+                throw encode_error("operand cannot be encoded in ModRM");
+        }
+
+        const u8 mod = displacement == 0 ? 0x00 : displacement <= 127 ? 0x40 : 0x80;
+        put(CAST<u8>(mod | reg_field | base));
+        if (base == 4) {
+            put(0x24);
+        }
+        if (mod == 0x40) {
+            put(CAST<u8>(displacement));
+        } else if (mod == 0x80) {
+            emit_u32(displacement);
+        }
+    }
+
+    void x86_encoder::emit_u32(u32 value) {
+        for (u32 i = 0; i < 4; ++i) {
+            put(CAST<u8>(value >> (8 * i)));
+        }
+    }
+}  // namespace mathc
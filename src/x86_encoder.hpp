@@ -0,0 +1,64 @@
+#pragma once
+
+#include "asm_instruction.hpp"
+
+#include <stdexcept>
+
+namespace mathc {
+    class encode_error : public std::runtime_error {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    /// @brief A 32-bit field in encoded code that the linker fills in with the distance to a symbol
+    struct code_reference {
+        u32 offset;          // of the field in the code
+        asm_operand target;  // OPERAND_LITERAL, OPERAND_DATA or OPERAND_LABEL
+        i32 addend;          // -4 minus any immediate after the field, since the distance is from the instruction's end
+    };
+
+    /// @brief Encoded instructions with the references the linker still has to resolve
+    struct machine_code {
+        vector<u8> bytes;
+        vector<code_reference> references;
+        vector<std::pair<asm_label, u32>> labels;  // labels defined in the code, with their offsets
+    };
+
+    /// @brief Turns instructions into x86-64 machine code, like NASM assembling what `asm_renderer` writes.
+    ///
+    /// Only the forms mathc generates are supported: SSE instructions (in VEX form with `vex` set, see
+    /// `written_operands`) on xmm registers and their 256-bit AVX forms on ymm registers, variables (`[rbx + disp]`),
+    /// spill slots (`[rsp + disp]`) and RIP-relative constants and data, and the few general-purpose instructions of
+    /// the prologue, epilogue and entry points. Anything else throws `encode_error`. Displacements use the shortest
+    /// encoding, like NASM.
+    class x86_encoder {
+    public:
+        /// `var_offsets` maps a variable's symbol id to its byte offset from rbx
+        static machine_code encode(const asm_code& code, span<const u32> var_offsets, bool vex);
+
+    private:
+        x86_encoder(span<const u32> var_offsets, bool vex) : var_offsets_(var_offsets), vex_(vex) {}
+
+        machine_code out_;
+        span<const u32> var_offsets_;
+        bool vex_;
+
+        void encode_instruction(const asm_instruction& instruction);
+        void encode_sse(const asm_instruction& instruction);
+        void encode_general(const asm_instruction& instruction);
+
+        /// `prefix` (if any), REX (if needed), `opcode` bytes, then ModRM and the rest for `reg` and `rm`.
+        /// `immediate_size` is the number of immediate bytes the caller appends after this.
+        void emit_legacy(u8 prefix, span<const u8> opcode, bool wide, u8 reg, const asm_operand& rm, u8 immediate_size);
+        /// VEX prefix for the legacy `prefix` and opcode `map`, `opcode`, then ModRM and the rest; `vvvv` is 0 when
+        /// the instruction has no such operand. `ymm` selects the 256-bit form (VEX.L).
+        void emit_vex(u8 prefix, u8 map, u8 opcode, bool wide, bool ymm, u8 reg, u8 vvvv, const asm_operand& rm,
+                      u8 immediate_size);
+        void emit_modrm(u8 reg, const asm_operand& rm, u8 immediate_size);
+        void emit_u32(u32 value);
+
+        void put(u8 byte) {
+            out_.bytes.push_back(byte);
+        }
+    };
+}  // namespace mathc
@@ -0,0 +1,25 @@
+default rel
+
+section .text
+global main
+extern mathc_print, mathc_flush
+
+section .rodata
+    align 8
+    lit_4081058fdfb0c619: dq 0x4081058fdfb0c619
+
+section .note.GNU-stack noalloc noexec nowrite progbits
+
+section .text
+main:
+    push rbp
+    mov rbp, rsp
+    movsd xmm0, [lit_4081058fdfb0c619]
+    ; Print value
+    call mathc_print
+    ; Exit
+    call mathc_flush
+    mov rsp, rbp
+    pop rbp
+    xor eax, eax
+    ret
@@ -0,0 +1,106 @@
+#!/bin/bash
+# Checks the encoder against an assembler: the object file mathc encodes (--emit=obj) must hold the same .text and
+# .rodata bytes, and the same relocations, as the listing it prints (--emit=asm) once assembled. Uses nasm when it is
+# installed, and GNU as on the listing translated to its Intel syntax otherwise.
+#
+#   tests/encoder_test.sh [mathc]    (default bin/mathc)
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+MATHC="$(realpath "${1:-$ROOT/bin/mathc}")"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# Runs of statements of the same shape, so the code generator packs them into pairs and quads, over every operator
+generate() {
+    awk -v seed="$1" 'BEGIN {
+        srand(seed);
+        split("+ - * / // %", operators, " ");
+        split("0 2 0.5 1.25 3 7", constants, " ");
+        for (v = 0; v < 12; ++v) printf "v%d = %s;\n", v, constants[int(rand() * 5) + 2];
+        for (run = 0; run < 40; ++run) {
+            count = int(rand() * 7) + 2;
+            outer = operators[int(rand() * 6) + 1];
+            inner = operators[int(rand() * 6) + 1];
+            for (i = 0; i < count; ++i) {
+                for (o = 0; o < 3; ++o) {
+                    operand[o] = rand() < 0.6 ? "v" int(rand() * 12) : constants[int(rand() * 6) + 1];
+                }
+                printf "v%d = (%s %s %s) %s %s;\n", int(rand() * 12), operand[0], inner, operand[1], outer, operand[2];
+            }
+            if (rand() < 0.3) printf "print(v%d);\n", int(rand() * 12);
+        }
+        for (v = 0; v < 12; ++v) printf "print(v%d);\n", v;
+    }'
+}
+
+# The NASM constructs the listings use, in GNU as syntax
+to_gas() {
+    sed -E \
+        -e 's/[[:space:]]*;.*$//' \
+        -e 's/^default rel$/.intel_syntax noprefix/' \
+        -e 's/^section \.note\.GNU-stack.*/.section .note.GNU-stack,"",@progbits/' \
+        -e 's/^section (\S+) align=([0-9]+)$/.section \1\n.balign \2/' \
+        -e 's/^section (\S+)$/.section \1/' \
+        -e 's/^global /.globl /' \
+        -e '/^extern /d' \
+        -e 's/^([[:space:]]*)align /\1.balign /' \
+        -e 's/^([[:space:]]*\w+:) resb /\1 .zero /' \
+        -e 's/^([[:space:]]*\w+:) dq /\1 .quad /' \
+        -e 's/^([[:space:]]*)db /\1.byte /' \
+        -e 's/\[([a-qs-z_]\w*)\]/[rip + \1]/g' \
+        "$1"
+}
+
+assemble() {
+    if command -v nasm >/dev/null; then
+        nasm -f elf64 "$1" -o "$2"
+    else
+        to_gas "$1" > "$1.gas"
+        as --64 "$1.gas" -o "$2"
+    fi
+}
+
+section_bytes() {
+    objcopy -O binary --only-section="$2" "$1" "$3" 2>/dev/null || : > "$3"
+}
+
+# Offset, type and target of each relocation; the target as a section or symbol name plus addend
+relocations() {
+    readelf -rW "$1" | awk '/^[0-9a-f]+ / { print $1, $3, $5, $6, $7 }'
+}
+
+cd "$WORK"
+mkdir -p programs
+cp "$ROOT"/test_code/*.math programs/
+for seed in 1 2 3 4 5 6; do
+    generate $seed > "programs/generated$seed.math"
+done
+
+failed=0
+for program in programs/*.math; do
+    name="$(basename "$program" .math)"
+    for flags in "" "-O0" "--march=x86-64" "--march=x86-64-v3 --fp-contract" "-O0 --march=x86-64-v3" "--no-peephole" \
+        "--freestanding" "--precompute"; do
+        # Without nasm, --emit=asm writes the listing and then fails to assemble it
+        rm -f "programs/build/$name.s"
+        "$MATHC" "$program" $flags --emit=asm >/dev/null 2>&1 || [ -f "programs/build/$name.s" ]
+        "$MATHC" "$program" $flags --emit=obj >/dev/null
+        assemble "programs/build/$name.s" assembled.o
+        for section in .text .rodata; do
+            section_bytes "programs/build/$name.o" "$section" encoded.bin
+            section_bytes assembled.o "$section" assembled.bin
+            if ! cmp -s encoded.bin assembled.bin; then
+                echo "$name [$flags]: $section differs from the assembled listing"
+                cmp encoded.bin assembled.bin | head -1 || true
+                failed=1
+            fi
+        done
+        if [ "$(relocations "programs/build/$name.o")" != "$(relocations assembled.o)" ]; then
+            echo "$name [$flags]: relocations differ from the assembled listing:"
+            diff <(relocations "programs/build/$name.o") <(relocations assembled.o) | head -6 || true
+            failed=1
+        fi
+    done
+done
+exit $failed
@@ -0,0 +1,145 @@
+// Checks float_parser against std::from_chars: formatted doubles, random digit strings with exponents across the
+// whole range, exact halfway points between neighbouring doubles (whose rounding depends on every digit), and the
+// literals it must reject.
+//
+//   float_parser_test [rounds]    (default 100000, about five literals each)
+
+#include "float_parser.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace mathc;
+
+namespace {
+    u64 checked  = 0;
+    u64 failures = 0;
+
+    void report(const string& literal, const char* what) {
+        if (++failures <= 20) {
+            std::printf("  %.80s: %s\n", literal.c_str(), what);
+        }
+    }
+
+    // The correctly rounded value of `literal`. from_chars leaves results out of range alone, so those come from
+    // strtod, which overflows to infinity and underflows to zero like the parser.
+    f64 expected(const string& literal) {
+        f64 value           = 0;
+        const auto [_, err] = std::from_chars(literal.data(), literal.data() + literal.size(), value);
+        if (err == std::errc::result_out_of_range) {
+            return std::strtod(literal.c_str(), nullptr);
+        }
+        return value;
+    }
+
+    void check(const string& literal) {
+        ++checked;
+        size_t pos = 0;
+        f64 value  = 0;
+        if (!float_parser::parse(literal, pos, value) || pos != literal.size()) {
+            report(literal, "rejected");
+            return;
+        }
+        const f64 want = expected(literal);
+        if (std::bit_cast<u64>(value) != std::bit_cast<u64>(want)) {
+            char message[96];
+            std::snprintf(message, sizeof(message), "got %.17g, want %.17g", value, want);
+            report(literal, message);
+        }
+    }
+
+    void check_rejected(const string& literal, size_t at) {
+        ++checked;
+        size_t pos = 0;
+        f64 value  = 0;
+        if (float_parser::parse(literal, pos, value) || pos != at) {
+            report(literal, "accepted, or rejected at the wrong position");
+        }
+    }
+
+    template <typename T>
+    string format(T value, std::chars_format how, int precision) {
+        array<char, 1024> buffer {};
+        const auto result = precision < 0 ? std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, how)
+                                          : std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, how,
+                                                          precision);
+        return {buffer.data(), result.ptr};
+    }
+
+    // A positive finite double with random bits; one in eight is subnormal
+    f64 random_double(std::mt19937_64& rng) {
+        for (;;) {
+            u64 bits = rng() & ~(u64(1) << 63);
+            if (rng() % 8 == 0) {
+                bits &= (u64(1) << 52) - 1;
+            }
+            const f64 value = std::bit_cast<f64>(bits);
+            if (std::isfinite(value)) {
+                return value;
+            }
+        }
+    }
+
+    string random_digits(std::mt19937_64& rng, size_t count) {
+        string digits;
+        for (size_t i = 0; i < count; ++i) {
+            digits += CAST<char>('0' + rng() % 10);
+        }
+        return digits;
+    }
+}  // namespace
+
+int main(int argc, char** argv) {
+    const u64 rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000;
+
+    for (const char* literal :
+         {"0", "0.0", "0e999", "1", "9007199254740993", "123456789012345678901234567890", "4.9406564584124654e-324",
+          "2.4703282292062327e-324", "2.4703282292062328e-324", "2.2250738585072011e-308", "2.2250738585072014e-308",
+          "1.7976931348623157e308", "1.7976931348623158e308", "1.7976931348623159e308", "1e400", "1e-400",
+          "1e99999999999999999999", "0.000000000000000000000000000000000000000000001e45", "7.2057594037927933e16",
+          "1.00000000000000011102230246251565404236316680908203125"}) {
+        check(literal);
+    }
+    check_rejected("1.2.3", 3);
+    check_rejected("1e", 2);
+    check_rejected("1e+", 3);
+    check_rejected("12abc", 2);
+    check_rejected("3_", 1);
+
+    std::mt19937_64 rng(1);
+    for (u64 round = 0; round < rounds; ++round) {
+        const f64 value = random_double(rng);
+        check(format(value, std::chars_format::general, -1));
+        check(format(value, std::chars_format::scientific, CAST<int>(rng() % 26)));
+        if (std::abs(std::log10(value)) < 40) {
+            check(format(value, std::chars_format::fixed, CAST<int>(rng() % 30)));
+        }
+
+        string literal = random_digits(rng, 1 + rng() % 25);
+        if (rng() % 2 == 0) {
+            literal += '.' + random_digits(rng, rng() % 25);
+        }
+        if (rng() % 4 != 0) {
+            literal += rng() % 2 == 0 ? "e-" : "e";
+            literal += std::to_string(rng() % 350);
+        }
+        check(literal);
+
+        // Halfway between `value` and the next double up, exactly, and cut short just below it. long double holds
+        // the halfway point exactly, and 800 digits are enough to print any of them in full.
+        const f64 next = std::nextafter(value, INFINITY);
+        if (std::isfinite(next)) {
+            const long double halfway = (CAST<long double>(value) + next) / 2;
+            const string exact        = format(halfway, std::chars_format::scientific, 800);
+            check(exact);
+            check(exact.substr(0, exact.find('e') - 1 - rng() % 700) + exact.substr(exact.find('e')));
+        }
+    }
+
+    std::printf("%llu literals, %llu wrong\n", CAST<unsigned long long>(checked), CAST<unsigned long long>(failures));
+    return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,61 @@
+#!/bin/bash
+# Checks that executables, which print through the C runtime (src/runtime/print_runtime.c), print byte for byte what
+# the backends running in the compiler's process print through print_runtime::format: --precompute, --run and
+# --interpret. Edge values and random ones, in both print formats.
+#
+#   tests/print_runtime_test.sh [mathc]    (default bin/mathc)
+set -euo pipefail
+
+ROOT="$(cd "$(dirname "$0")/.." && pwd)"
+MATHC="$(realpath "${1:-$ROOT/bin/mathc}")"
+WORK="$(mktemp -d)"
+trap 'rm -rf "$WORK"' EXIT
+
+# Literals are unsigned, so negative values are printed as 0 - x
+values() {
+    for literal in 0 1 0.1 0.5 1.5 2.5 1e-5 1e-4 123456789012345 999999999999999 1e15 1000000000000005 \
+        1000000000000015 9007199254740993 9999999999999998 1e16 12345678901234567 10000000000000050 99999999999999999 \
+        1e17 123456789012345678 1e21 1e22 1e23 4.9406564584124654e-324 9.8813129168249309e-324 1e-310 \
+        2.2250738585072009e-308 2.2250738585072014e-308 1.7976931348623157e308 5e-324 0.3 2.675 1.0000000000000002 \
+        0.30000000000000004 1234567.1234567 0.000123456789012345; do
+        echo "print($literal);"
+        echo "print(0 - $literal);"
+    done
+    echo "print(0 * (0 - 1));"
+    echo "print(1e308 * 10);"
+    echo "print(0 - 1e308 * 10);"
+    echo "print(1e308 * 10 - 1e308 * 10);"
+    echo "print(0 - (1e308 * 10 - 1e308 * 10));"
+
+    # Random significands of up to 17 digits at every exponent
+    awk 'BEGIN {
+        srand(17);
+        for (i = 0; i < 2000; ++i) {
+            digits = int(rand() * 17) + 1;
+            significand = "";
+            for (d = 0; d < digits; ++d) significand = significand int(rand() * 10);
+            fraction = digits > 1 ? substr(significand, 2) : "0";
+            printf "print(%s.%se%d);\n", substr(significand, 1, 1), fraction, int(rand() * 630) - 323;
+        }
+    }'
+}
+
+values > "$WORK/values.math"
+cd "$WORK"
+failed=0
+for format in "" "--print=shortest"; do
+    "$MATHC" values.math -O0 $format >/dev/null
+    ./build/values > executable.out
+    "$MATHC" values.math -O0 $format --precompute >/dev/null
+    ./build/values > precompute.out
+    "$MATHC" values.math -O0 $format --run > run.out
+    "$MATHC" values.math -O0 $format --interpret > interpret.out
+    for backend in precompute run interpret; do
+        if ! cmp -s executable.out "$backend.out"; then
+            echo "${format:-default format}: --$backend prints differently from the executable:"
+            diff executable.out "$backend.out" | head -10
+            failed=1
+        fi
+    done
+done
+exit $failed